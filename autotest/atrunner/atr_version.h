@@ -11,10 +11,12 @@
  * brief:   DQ Compiler Auto-Test Runner Version Description
  */
 
-#define ATR_VERSION  "0.0.11"
+#define ATR_VERSION  "0.0.13"
 
 /* CHANGE LOG
 ------------------------------------------------------------------------------------
+v0.0.13: //?ircheck(...) marker: checks the -ir output of the run variant
+v0.0.12: //?options(...) marker: extra compiler options
 v0.0.11: parallel run termination fix
 v0.0.10: single mode compiler error show fix
 v0.0.9: working error tests
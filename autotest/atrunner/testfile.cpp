@@ -19,6 +19,7 @@
 #include <print>
 #include <format>
 #include <fstream>
+#include <sstream>
 #include <filesystem>
 
 #include "atr_options.h"
@@ -61,6 +62,13 @@ void OTestFile::Process()
     return;
   }
 
+  if (is_unit)
+  {
+    // tested only together with the files referencing it with //?units(...)
+    processed = true;
+    return;
+  }
+
   if (run_captures.empty() and err_captures.empty())
   {
     // no atr marker was found
@@ -139,7 +147,20 @@ void OTestFile::ExecRunTest()
     print("Compiler output:\n{}\n", comp_out);
   }
 
-  // 2. Executing the compiled test file
+  // 2. Checking the printed IR for the //?ircheck(...) texts
+  for (const string & irtext : ir_checks)
+  {
+    if (string::npos == comp_out.find(irtext))
+    {
+      AddRunError(format("IRCHECK: \"{}\" is missing from the IR", irtext));
+      if (!g_atropt->batchmode)
+      {
+        print("{}\n", msg_run.back());
+      }
+    }
+  }
+
+  // 3. Executing the compiled test file
   string exename = fs::path(filename).replace_extension("exe").generic_string();
   #ifndef _WIN32
     // adding "./" to the front for local files
@@ -634,6 +655,24 @@ bool OTestFile::ParseText()
       {
         ParseMarkerCheck(true);
       }
+      else if ("ircheck" == sid)
+      {
+        ParseMarkerIrCheck();
+      }
+
+      // compile options
+      else if ("options" == sid)
+      {
+        ParseMarkerList(sid, comp_options);
+      }
+      else if ("units" == sid)
+      {
+        ParseMarkerList(sid, comp_units);
+      }
+      else if ("unit" == sid)
+      {
+        is_unit = true;
+      }
       else
       {
         AddTfError(format("Unknown marker \"{}\"", sid));
@@ -747,6 +786,59 @@ void OTestFile::ParseMarkerCheck(bool aignore)
   run_captures.push_back(new ORunCapture(strid, sv));
 }
 
+void OTestFile::ParseMarkerIrCheck()
+{
+  // sample: //?ircheck('!"llvm.loop.unroll.count", i32 4}')
+  // note "//?ircheck" is already consumed
+
+  sp.SkipSpaces(false);
+  if (not sp.CheckSymbol("("))
+  {
+    AddTfError(format("\"(\" is missing after \"//?ircheck\""));
+    return;
+  }
+  sp.SkipSpaces(false);
+  if (not sp.ReadQuotedString())
+  {
+    AddTfError(format("Quoted text is missing after \"//?ircheck\""));
+    return;
+  }
+  ir_checks.push_back(sp.PrevStr());
+
+  sp.SkipSpaces(false);
+  if (not sp.CheckSymbol(")"))
+  {
+    AddTfError(format("\")\" is missing after \"//?ircheck\""));
+    return;
+  }
+}
+
+void OTestFile::ParseMarkerList(const string amarker, vector<string> & rlist)
+{
+  // samples: //?options(-O2 -ffast-math), //?units(multiunit_b.dq)
+  // note "//?<amarker>" is already consumed
+
+  sp.SkipSpaces(false);
+  if (not sp.CheckSymbol("("))
+  {
+    AddTfError(format("\"(\" is missing after \"//?{}\"", amarker));
+    return;
+  }
+  if (not sp.ReadToChar(')'))
+  {
+    AddTfError(format("\")\" is missing after \"//?{}\"", amarker));
+    return;
+  }
+
+  istringstream liststream(sp.PrevStr());
+  string item;
+  while (liststream >> item)
+  {
+    rlist.push_back(item);
+  }
+  sp.CheckSymbol(")");
+}
+
 void OTestFile::AddTfError(const string astr)
 {
   int linenum = sp.GetLineNum(sp.prevptr);
@@ -766,11 +858,22 @@ bool OTestFile::ExecCompiler(bool errmode)
 
   string exename = fs::path(filename).replace_extension("exe").generic_string();
 
-  procrunner.args = { g_atropt->compiler_filename, filename, "-o", exename };
+  procrunner.args = { g_atropt->compiler_filename, filename };
+  for (const string & unit : comp_units)
+  {
+    procrunner.args.push_back((fs::path(filename).parent_path() / unit).generic_string());
+  }
+  procrunner.args.push_back("-o");
+  procrunner.args.push_back(exename);
   if (errmode)
   {
     procrunner.args.push_back("-DERRORTEST");
   }
+  else if (not ir_checks.empty())
+  {
+    procrunner.args.push_back("-ir");  // the IR goes to the compiler output, the error variant would not accept it
+  }
+  procrunner.args.insert(procrunner.args.end(), comp_options.begin(), comp_options.end());
   if (!procrunner.Run())
   {
     result = false;
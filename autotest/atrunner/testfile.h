@@ -68,6 +68,7 @@ public:
 
   bool              exec_run   = false;
   bool              exec_err   = false;
+  bool              is_unit    = false;  // //?unit: compiled only as an additional unit of other tests
 
   int               errorcnt_err = 0;
   int               errorcnt_run = 0;
@@ -75,6 +76,9 @@ public:
 
   vector<OErrCapture *>  err_captures;
   vector<ORunCapture *>  run_captures;
+  vector<string>         comp_options;  // //?options(...): extra compiler options for both variants
+  vector<string>         comp_units;    // //?units(...): additional source files, relative to the test file
+  vector<string>         ir_checks;     // //?ircheck(...): texts of the -ir output in the run variant
 
   vector<string>    msg_err;
   vector<string>    msg_run;
@@ -112,6 +116,8 @@ protected:
   bool ParseText();
   void ParseMarkerError(const string amsgid);
   void ParseMarkerCheck(bool aignore);
+  void ParseMarkerIrCheck();
+  void ParseMarkerList(const string amarker, vector<string> & rlist);
 
   void AddTfError(const string astr);
   void AddTfErrorNoLine(const string astr);
@@ -20,6 +20,9 @@ void OAttr::Reset()
   flags = 0;
   align_value = 0;
   section_name = "";
+  unroll_count = 0;
+  vectorize_width = 0;
+  interleave_count = 0;
 }
 
 void OAttr::CheckInvalidAttributes(EAttrTarget atarget)
@@ -31,6 +34,31 @@ void OAttr::CheckInvalidAttributes(EAttrTarget atarget)
   CheckAttrAllowed(ATTF_OVERRIDE, atarget, ATGT_FUNCTION);
   CheckAttrAllowed(ATTF_VIRTUAL,  atarget, ATGT_FUNCTION);
   CheckAttrAllowed(ATTF_VOLATILE, atarget, ATGT_GLOBAL_VAR | ATGT_STRUCT_MEMBER);
+  CheckAttrAllowed(ATTF_FASTMATH, atarget, ATGT_FUNCTION);
+  CheckAttrAllowed(ATTF_OVERFLOW, atarget, ATGT_FUNCTION);
+  CheckAttrAllowed(ATTF_CONSTEVAL, atarget, ATGT_FUNCTION);
+  CheckAttrAllowed(ATTF_BOUNDS_CHECK, atarget, ATGT_FUNCTION);
+  CheckAttrAllowed(ATTF_INLINE,   atarget, ATGT_FUNCTION);
+  CheckAttrAllowed(ATTF_NOINLINE, atarget, ATGT_FUNCTION);
+  CheckAttrAllowed(ATTF_FLATTEN,  atarget, ATGT_FUNCTION);
+  CheckAttrAllowed(ATTF_HOT,      atarget, ATGT_FUNCTION);
+  CheckAttrAllowed(ATTF_COLD,     atarget, ATGT_FUNCTION);
+  CheckAttrAllowed(ATTF_PURE,     atarget, ATGT_FUNCTION);
+  CheckAttrAllowed(ATTF_READNONE, atarget, ATGT_FUNCTION);
+  CheckAttrAllowed(ATTF_UNROLL,        atarget, ATGT_LOOP);
+  CheckAttrAllowed(ATTF_NO_UNROLL,     atarget, ATGT_LOOP);
+  CheckAttrAllowed(ATTF_VECTORIZE,     atarget, ATGT_LOOP);
+  CheckAttrAllowed(ATTF_NO_VECTORIZE,  atarget, ATGT_LOOP);
+  CheckAttrAllowed(ATTF_INTERLEAVE,    atarget, ATGT_LOOP);
+
+  CheckAttrConflict(ATTF_UNROLL, ATTF_NO_UNROLL);
+  CheckAttrConflict(ATTF_VECTORIZE, ATTF_NO_VECTORIZE);
+  CheckAttrConflict(ATTF_CONSTEVAL, ATTF_EXTERNAL);
+  CheckAttrConflict(ATTF_INLINE, ATTF_NOINLINE);
+  CheckAttrConflict(ATTF_HOT, ATTF_COLD);
+  CheckAttrConflict(ATTF_PURE, ATTF_READNONE);
+  CheckAttrConflict(ATTF_INLINE, ATTF_EXTERNAL);
+  CheckAttrConflict(ATTF_FLATTEN, ATTF_EXTERNAL);
 }
 
 void OAttr::CheckAttrAllowed(EAttrFlag aflag, EAttrTarget atarget, uint32_t allowed_target_mask)
@@ -41,6 +69,14 @@ void OAttr::CheckAttrAllowed(EAttrFlag aflag, EAttrTarget atarget, uint32_t allo
   }
 }
 
+void OAttr::CheckAttrConflict(EAttrFlag aflag1, EAttrFlag aflag2)
+{
+  if (IsSet(aflag1) && IsSet(aflag2))
+  {
+    g_compiler->Error(DQERR_ATTR_CONFLICT, AttrName(aflag1), AttrName(aflag2), &scpos);
+  }
+}
+
 //--------------------------------------
 
 string AttrName(EAttrFlag aflag)
@@ -51,9 +87,25 @@ string AttrName(EAttrFlag aflag)
     case ATTF_VOLATILE:      return "volatile";
     case ATTF_OVERLOAD:      return "overload";
     case ATTF_EXTERNAL:      return "external";
+    case ATTF_INLINE:        return "inline";
+    case ATTF_NOINLINE:      return "noinline";
+    case ATTF_FLATTEN:       return "flatten";
+    case ATTF_HOT:           return "hot";
+    case ATTF_COLD:          return "cold";
+    case ATTF_PURE:          return "pure";
+    case ATTF_READNONE:      return "readnone";
     case ATTF_SECTION:       return "section";
     case ATTF_VIRTUAL:       return "virtual";
     case ATTF_OVERRIDE:      return "override";
+    case ATTF_FASTMATH:      return "fastmath";
+    case ATTF_OVERFLOW:      return "overflow";
+    case ATTF_CONSTEVAL:     return "consteval";
+    case ATTF_BOUNDS_CHECK:  return "bounds_check";
+    case ATTF_UNROLL:        return "unroll";
+    case ATTF_NO_UNROLL:     return "no_unroll";
+    case ATTF_VECTORIZE:     return "vectorize";
+    case ATTF_NO_VECTORIZE:  return "no_vectorize";
+    case ATTF_INTERLEAVE:    return "interleave";
 
     default:                 return "ATTR_"+to_string(aflag);
   }
@@ -67,6 +119,8 @@ string AttrTargetName(EAttrTarget atarget)
     case ATGT_GLOBAL_VAR:    return "global variable";
     case ATGT_GLOBAL_CONST:  return "global constant";
     case ATGT_STRUCT_MEMBER: return "struct member";
+    case ATGT_LOOP:          return "loop";
+    case ATGT_STATEMENT:     return "statement";
 
     default:                 return "ATGT_"+to_string(atarget);
   }
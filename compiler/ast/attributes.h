@@ -22,12 +22,37 @@ enum EAttrFlag
   ATTF_VOLATILE       = 0x00000002,
   ATTF_OVERLOAD       = 0x00000004,
 
+  // inlining hints of the functions
+  ATTF_INLINE         = 0x00000010,
+  ATTF_NOINLINE       = 0x00000020,
+  ATTF_FLATTEN        = 0x00000040,  // the calls in the function body are inlined
+
   ATTF_EXTERNAL       = 0x00000100,
 
+  // code placement hints of the functions
+  ATTF_HOT            = 0x00000200,
+  ATTF_COLD           = 0x00000400,
+
   ATTF_SECTION        = 0x00001000,  // special linker section
 
+  // side effects of the functions
+  ATTF_PURE           = 0x00002000,  // no side effects, reads only memory
+  ATTF_READNONE       = 0x00004000,  // no side effects, the result depends only on the arguments
+
   ATTF_VIRTUAL        = 0x00010000,
   ATTF_OVERRIDE       = 0x00020000,
+
+  ATTF_FASTMATH       = 0x00100000,  // fast-math flags for the floating point operations
+  ATTF_OVERFLOW       = 0x00200000,  // integer overflow model: wrap, nsw, trap
+  ATTF_CONSTEVAL      = 0x00400000,  // function evaluated at compile time in constant expressions
+  ATTF_BOUNDS_CHECK   = 0x00800000,  // index bounds checking: on, off
+
+  // loop optimization hints, stored as llvm.loop metadata
+  ATTF_UNROLL         = 0x01000000,
+  ATTF_NO_UNROLL      = 0x02000000,
+  ATTF_VECTORIZE      = 0x04000000,
+  ATTF_NO_VECTORIZE   = 0x08000000,
+  ATTF_INTERLEAVE     = 0x10000000,
 };
 
 enum EAttrTarget
@@ -37,7 +62,9 @@ enum EAttrTarget
   ATGT_GLOBAL_VAR     = 0x0002,
   ATGT_GLOBAL_CONST   = 0x0004,
 
-  ATGT_STRUCT_MEMBER  = 0x0008   //TODO: member var, member func would be better
+  ATGT_STRUCT_MEMBER  = 0x0008,  //TODO: member var, member func would be better
+  ATGT_LOOP           = 0x0010,  // while, for
+  ATGT_STATEMENT      = 0x0020   // other statements in a function body
 };
 
 class OAttr
@@ -50,12 +77,18 @@ public:
   int64_t        align_value = 0;
   string         external_linkage_name = "";
   string         section_name = "";
+  int            overflow_mode = 0;  // EIntOverflow
+  int            bounds_check_mode = 0;  // 0 = on, 1 = off
+  int64_t        unroll_count = 0;       // 0 = unroll decided by the optimizer
+  int64_t        vectorize_width = 0;    // 0 = width decided by the optimizer
+  int64_t        interleave_count = 0;
 
   void Reset();
   inline void SetFlag(EAttrFlag aflag) { flags |= aflag; }
   inline bool IsSet(EAttrFlag aflag) { return ((flags & aflag) != 0); }
   void CheckInvalidAttributes(EAttrTarget atarget);
   void CheckAttrAllowed(EAttrFlag aflag, EAttrTarget atarget, uint32_t allowed_target_mask);
+  void CheckAttrConflict(EAttrFlag aflag1, EAttrFlag aflag2);
 
 };
 
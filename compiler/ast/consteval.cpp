@@ -0,0 +1,933 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    consteval.cpp
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   compile-time evaluation of the [[consteval]] functions
+ */
+
+#include <cmath>
+#include "consteval.h"
+#include "otype_int.h"
+#include "otype_float.h"
+#include "otype_bool.h"
+#include "otype_array.h"
+#include "otype_func.h"
+#include "dqc.h"
+
+OExpr * OConstEvaluator::EvaluateCall(OCallExpr * acall)
+{
+  topfunc = acall->vsfunc;
+
+  // the arguments are evaluated at the call site, where only the constants are available
+  map<OValSym *, OConstEvalValue>  noframe;
+  locals = &noframe;
+
+  OConstEvalValue  result;
+  if (not EvalCall(acall, result))
+  {
+    return nullptr;
+  }
+
+  return CreateLiteral(result);
+}
+
+bool OConstEvaluator::EvalCall(OCallExpr * acall, OConstEvalValue & rvalue)
+{
+  OValSymFunc * vsfunc = acall->vsfunc;
+  if (not vsfunc->attr_consteval)
+  {
+    if (emit_errors)
+    {
+      g_compiler->Error(DQERR_CONSTEVAL_CALL, vsfunc->name);
+    }
+    return false;
+  }
+
+  vector<OConstEvalValue>  argvalues(acall->args.size());
+  for (size_t i = 0; i < acall->args.size(); ++i)
+  {
+    if (not EvalExpr(acall->args[i], argvalues[i]))
+    {
+      return false;
+    }
+  }
+
+  return CallFunc(vsfunc, argvalues, rvalue);
+}
+
+bool OConstEvaluator::CallFunc(OValSymFunc * avsfunc, vector<OConstEvalValue> & aargs, OConstEvalValue & rresult)
+{
+  if (not avsfunc->has_body)
+  {
+    if (emit_errors)
+    {
+      g_compiler->Error(DQERR_CONSTEVAL_NO_BODY, avsfunc->name);
+    }
+    return false;
+  }
+
+  if (depth >= max_depth)
+  {
+    if (emit_errors)
+    {
+      g_compiler->Error(DQERR_CONSTEVAL_LIMIT, avsfunc->name, format("call depth limit ({})", max_depth));
+    }
+    return false;
+  }
+
+  if (aargs.size() != avsfunc->args.size())
+  {
+    return Unsupported("This call form");
+  }
+
+  map<OValSym *, OConstEvalValue>  frame;
+  for (size_t i = 0; i < aargs.size(); ++i)
+  {
+    OValSym * vsarg = avsfunc->args[i];
+    if ((FPM_VALUE != vsarg->param_mode) and (FPM_REFIN != vsarg->param_mode))  // refin is read only, a copy is fine
+    {
+      return Unsupported(format("The reference parameter \"{}\"", vsarg->name));
+    }
+    if (not Convert(aargs[i], vsarg->ptype))
+    {
+      return false;
+    }
+    frame[vsarg] = std::move(aargs[i]);
+  }
+
+  if (avsfunc->vsresult and not InitZero(frame[avsfunc->vsresult], avsfunc->vsresult->ptype))
+  {
+    return false;
+  }
+
+  map<OValSym *, OConstEvalValue> *  prevlocals = locals;
+  OValSymFunc *                      prevfunc = curfunc;
+  locals = &frame;
+  curfunc = avsfunc;
+  ++depth;
+
+  EConstEvalFlow flow = ExecBlock(avsfunc->body);
+
+  --depth;
+  curfunc = prevfunc;
+  locals = prevlocals;
+
+  if (CEFLOW_ERROR == flow)
+  {
+    return false;
+  }
+
+  if (avsfunc->vsresult)
+  {
+    rresult = std::move(frame[avsfunc->vsresult]);
+  }
+  return true;
+}
+
+EConstEvalFlow OConstEvaluator::ExecBlock(OStmtBlock * ablock)
+{
+  for (OStmt * st : ablock->stlist)
+  {
+    EConstEvalFlow flow = ExecStatement(st);
+    if (CEFLOW_NEXT != flow)
+    {
+      return flow;
+    }
+  }
+  return CEFLOW_NEXT;
+}
+
+EConstEvalFlow OConstEvaluator::ExecStatement(OStmt * astmt)
+{
+  if (not CountStep())
+  {
+    return CEFLOW_ERROR;
+  }
+
+  if (auto * st = dynamic_cast<OStmtVarDecl *>(astmt))
+  {
+    if (st->variable->IsRefLike())
+    {
+      Unsupported(format("The reference variable \"{}\"", st->variable->name));
+      return CEFLOW_ERROR;
+    }
+
+    OConstEvalValue v;
+    if (st->initvalue)
+    {
+      if (not EvalExpr(st->initvalue, v) or not Convert(v, st->variable->ptype))
+      {
+        return CEFLOW_ERROR;
+      }
+    }
+    else if (not InitZero(v, st->variable->ptype))
+    {
+      return CEFLOW_ERROR;
+    }
+    (*locals)[st->variable] = std::move(v);
+    return CEFLOW_NEXT;
+  }
+
+  if (auto * st = dynamic_cast<OStmtAssign *>(astmt))
+  {
+    OConstEvalValue v;
+    if (not EvalExpr(st->value, v) or not Convert(v, st->target->ptype))
+    {
+      return CEFLOW_ERROR;
+    }
+    OConstEvalValue * target = EvalRef(st->target, true);
+    if (not target)
+    {
+      return CEFLOW_ERROR;
+    }
+    *target = std::move(v);
+    return CEFLOW_NEXT;
+  }
+
+  if (auto * st = dynamic_cast<OStmtModifyAssign *>(astmt))
+  {
+    OType * ttype = st->target->ResolvedType();
+    OConstEvalValue v;
+    if (not EvalExpr(st->value, v) or not Convert(v, ttype))
+    {
+      return CEFLOW_ERROR;
+    }
+    OConstEvalValue * target = EvalRef(st->target, true);
+    if (not target)
+    {
+      return CEFLOW_ERROR;
+    }
+
+    OConstEvalValue cur = *target;
+    bool ok;
+    if (TK_INT == ttype->kind)
+    {
+      ok = IntBinOp(st->op, ttype, cur, v, *target);
+    }
+    else if (TK_FLOAT == ttype->kind)
+    {
+      ok = FloatBinOp(st->op, ttype, cur, v, *target);
+    }
+    else
+    {
+      ok = Unsupported(format("The \"{}=\" for \"{}\"", GetBinopSymbol(st->op), ttype->name));
+    }
+    return (ok ? CEFLOW_NEXT : CEFLOW_ERROR);
+  }
+
+  if (auto * st = dynamic_cast<OStmtVoidCall *>(astmt))
+  {
+    auto * callexpr = dynamic_cast<OCallExpr *>(st->callexpr);
+    if (not callexpr)
+    {
+      Unsupported("This call form");
+      return CEFLOW_ERROR;
+    }
+    OConstEvalValue v;
+    return (EvalCall(callexpr, v) ? CEFLOW_NEXT : CEFLOW_ERROR);
+  }
+
+  if (auto * st = dynamic_cast<OStmtReturn *>(astmt))
+  {
+    if (st->value)
+    {
+      OConstEvalValue v;
+      if (not EvalExpr(st->value, v) or not Convert(v, curfunc->vsresult->ptype))
+      {
+        return CEFLOW_ERROR;
+      }
+      (*locals)[curfunc->vsresult] = std::move(v);
+    }
+    return CEFLOW_RETURN;
+  }
+
+  if (auto * st = dynamic_cast<OStmtWhile *>(astmt))
+  {
+    while (true)
+    {
+      OConstEvalValue cond;
+      if (not EvalExpr(st->condition, cond))
+      {
+        return CEFLOW_ERROR;
+      }
+      if (not cond.ivalue)
+      {
+        return CEFLOW_NEXT;
+      }
+
+      EConstEvalFlow flow = ExecBlock(st->body);
+      if (CEFLOW_NEXT != flow)
+      {
+        return flow;
+      }
+      if (not CountStep())
+      {
+        return CEFLOW_ERROR;
+      }
+    }
+  }
+
+  if (auto * st = dynamic_cast<OStmtFor *>(astmt))
+  {
+    // the end is exclusive and evaluated once
+    OConstEvalValue vstart;
+    OConstEvalValue vend;
+    if (not EvalExpr(st->startexpr, vstart) or not EvalExpr(st->endexpr, vend))
+    {
+      return CEFLOW_ERROR;
+    }
+
+    OType * vartype = st->loopvar->ResolvedType();
+    for (int64_t i = vstart.ivalue; i < vend.ivalue; ++i)
+    {
+      OConstEvalValue & loopvalue = (*locals)[st->loopvar];
+      loopvalue.ptype = vartype;
+      loopvalue.ivalue = i;
+
+      EConstEvalFlow flow = ExecBlock(st->body);
+      if (CEFLOW_NEXT != flow)
+      {
+        return flow;
+      }
+      if (not CountStep())
+      {
+        return CEFLOW_ERROR;
+      }
+    }
+    return CEFLOW_NEXT;
+  }
+
+  if (auto * st = dynamic_cast<OStmtIf *>(astmt))
+  {
+    for (OIfBranch * branch : st->branches)
+    {
+      if (branch->condition)
+      {
+        OConstEvalValue cond;
+        if (not EvalExpr(branch->condition, cond))
+        {
+          return CEFLOW_ERROR;
+        }
+        if (not cond.ivalue)
+        {
+          continue;
+        }
+      }
+      return ExecBlock(branch->body);
+    }
+    return CEFLOW_NEXT;
+  }
+
+  Unsupported("This statement");
+  return CEFLOW_ERROR;
+}
+
+OConstEvalValue * OConstEvaluator::EvalRef(OLValueExpr * alvalue, bool awrite)
+{
+  if (auto * ex = dynamic_cast<OLValueVar *>(alvalue))
+  {
+    auto it = locals->find(ex->pvalsym);
+    if (it != locals->end())
+    {
+      return &it->second;
+    }
+
+    auto * vsconst = dynamic_cast<OValSymConst *>(ex->pvalsym);
+    if (vsconst and not awrite)
+    {
+      auto cit = consts.find(vsconst);
+      if (cit != consts.end())
+      {
+        return &cit->second;
+      }
+
+      OConstEvalValue & v = consts[vsconst];
+      if (not FromConstValue(vsconst->pvalue, v))
+      {
+        consts.erase(vsconst);
+        return nullptr;
+      }
+      return &v;
+    }
+
+    if (emit_errors)
+    {
+      g_compiler->Error(DQERR_CONSTEXPR_NONCONST_SYM, ex->pvalsym->name, "compile-time");
+    }
+    return nullptr;
+  }
+
+  if (auto * ex = dynamic_cast<OLValueIndex *>(alvalue))
+  {
+    OType * ctype = ex->containertype->ResolveAlias();
+    if (TK_ARRAY != ctype->kind)
+    {
+      Unsupported(format("Indexing of \"{}\"", ctype->name));
+      return nullptr;
+    }
+
+    OConstEvalValue vindex;
+    if (not EvalExpr(ex->indexexpr, vindex))
+    {
+      return nullptr;
+    }
+
+    OConstEvalValue * base = EvalRef(ex->base, awrite);
+    if (not base)
+    {
+      return nullptr;
+    }
+
+    if ((vindex.ivalue < 0) or (uint64_t(vindex.ivalue) >= base->elements.size()))
+    {
+      if (emit_errors)
+      {
+        g_compiler->Error(DQERR_CONSTEVAL_INDEX, to_string(vindex.ivalue), to_string(int64_t(base->elements.size()) - 1),
+                          FuncName());
+      }
+      return nullptr;
+    }
+    return &base->elements[vindex.ivalue];
+  }
+
+  Unsupported("This kind of variable access");
+  return nullptr;
+}
+
+bool OConstEvaluator::EvalExpr(OExpr * aexpr, OConstEvalValue & rvalue)
+{
+  OType * extype = aexpr->ResolvedType();
+
+  if (auto * ex = dynamic_cast<OIntLit *>(aexpr))
+  {
+    rvalue.ptype = extype;
+    rvalue.ivalue = ex->value;
+    return true;
+  }
+
+  if (auto * ex = dynamic_cast<OFloatLit *>(aexpr))
+  {
+    rvalue.ptype = extype;
+    rvalue.fvalue = ex->value;
+    return true;
+  }
+
+  if (auto * ex = dynamic_cast<OBoolLit *>(aexpr))
+  {
+    rvalue.ptype = extype;
+    rvalue.ivalue = (ex->value ? 1 : 0);
+    return true;
+  }
+
+  if (auto * ex = dynamic_cast<OLValueExpr *>(aexpr))
+  {
+    OConstEvalValue * v = EvalRef(ex, false);
+    if (not v)
+    {
+      return false;
+    }
+    rvalue = *v;
+    return true;
+  }
+
+  if (auto * ex = dynamic_cast<OExprTypeConv *>(aexpr))
+  {
+    return (EvalExpr(ex->src, rvalue) and Convert(rvalue, extype));
+  }
+
+  if (auto * ex = dynamic_cast<OBinExpr *>(aexpr))
+  {
+    OConstEvalValue vleft;
+    OConstEvalValue vright;
+    if (not EvalExpr(ex->left, vleft) or not EvalExpr(ex->right, vright))
+    {
+      return false;
+    }
+
+    if (TK_INT == extype->kind)
+    {
+      return IntBinOp(ex->op, extype, vleft, vright, rvalue);
+    }
+    if (TK_FLOAT == extype->kind)
+    {
+      return FloatBinOp(ex->op, extype, vleft, vright, rvalue);
+    }
+    return Unsupported(format("The operation \"{}\" for \"{}\"", GetBinopSymbol(ex->op), extype->name));
+  }
+
+  if (auto * ex = dynamic_cast<OCompareExpr *>(aexpr))
+  {
+    OConstEvalValue vleft;
+    OConstEvalValue vright;
+    if (not EvalExpr(ex->left, vleft) or not EvalExpr(ex->right, vright))
+    {
+      return false;
+    }
+    return Compare(ex->op, vleft, vright, rvalue);
+  }
+
+  if (auto * ex = dynamic_cast<OLogicalExpr *>(aexpr))
+  {
+    OConstEvalValue vleft;
+    if (not EvalExpr(ex->left, vleft))
+    {
+      return false;
+    }
+
+    rvalue.ptype = extype;
+    if ((LOGIOP_AND == ex->op) and not vleft.ivalue)
+    {
+      rvalue.ivalue = 0;
+      return true;
+    }
+    if ((LOGIOP_OR == ex->op) and vleft.ivalue)
+    {
+      rvalue.ivalue = 1;
+      return true;
+    }
+
+    OConstEvalValue vright;
+    if (not EvalExpr(ex->right, vright))
+    {
+      return false;
+    }
+    if (LOGIOP_XOR == ex->op)
+    {
+      rvalue.ivalue = ((vleft.ivalue != 0) != (vright.ivalue != 0) ? 1 : 0);
+    }
+    else
+    {
+      rvalue.ivalue = (vright.ivalue ? 1 : 0);
+    }
+    return true;
+  }
+
+  if (auto * ex = dynamic_cast<ONotExpr *>(aexpr))
+  {
+    if (not EvalExpr(ex->operand, rvalue))
+    {
+      return false;
+    }
+    rvalue.ivalue = (rvalue.ivalue ? 0 : 1);
+    return true;
+  }
+
+  if (auto * ex = dynamic_cast<OBinNotExpr *>(aexpr))
+  {
+    if (not EvalExpr(ex->operand, rvalue) or (TK_INT != extype->kind))
+    {
+      return false;
+    }
+    rvalue.ptype = extype;
+    rvalue.ivalue = NormalizeIntConstant(static_cast<OTypeInt *>(extype), ~uint64_t(rvalue.ivalue));
+    return true;
+  }
+
+  if (auto * ex = dynamic_cast<ONegExpr *>(aexpr))
+  {
+    if (not EvalExpr(ex->operand, rvalue))
+    {
+      return false;
+    }
+    rvalue.ptype = extype;
+    if (TK_FLOAT == extype->kind)
+    {
+      rvalue.fvalue = -rvalue.fvalue;
+      return true;
+    }
+    if (TK_INT == extype->kind)
+    {
+      rvalue.ivalue = NormalizeIntConstant(static_cast<OTypeInt *>(extype), 0 - uint64_t(rvalue.ivalue));
+      return true;
+    }
+    return Unsupported(format("The negation of \"{}\"", extype->name));
+  }
+
+  if (auto * ex = dynamic_cast<OFloatRoundExpr *>(aexpr))
+  {
+    OConstEvalValue vsrc;
+    if (not EvalExpr(ex->src, vsrc) or not Convert(vsrc, g_builtins->type_float))
+    {
+      return false;
+    }
+
+    double r;
+    if      (RNDMODE_ROUND == ex->mode)  r = std::round(vsrc.fvalue);
+    else if (RNDMODE_CEIL  == ex->mode)  r = std::ceil(vsrc.fvalue);
+    else                                 r = std::floor(vsrc.fvalue);
+
+    rvalue.ptype = g_builtins->type_float;
+    rvalue.fvalue = r;
+    return Convert(rvalue, extype);
+  }
+
+  if (auto * ex = dynamic_cast<OIifExpr *>(aexpr))
+  {
+    OConstEvalValue cond;
+    if (not EvalExpr(ex->condition, cond))
+    {
+      return false;
+    }
+    return (EvalExpr((cond.ivalue ? ex->true_expr : ex->false_expr), rvalue) and Convert(rvalue, extype));
+  }
+
+  if (auto * ex = dynamic_cast<OArrayLit *>(aexpr))
+  {
+    if (TK_ARRAY != extype->kind)
+    {
+      return Unsupported(format("The \"{}\" literal", extype->name));
+    }
+
+    OType * elemtype = static_cast<OTypeArray *>(extype)->elemtype;
+    rvalue.ptype = extype;
+    rvalue.elements.clear();
+    rvalue.elements.resize(ex->elements.size());
+    for (size_t i = 0; i < ex->elements.size(); ++i)
+    {
+      if (not EvalExpr(ex->elements[i], rvalue.elements[i]) or not Convert(rvalue.elements[i], elemtype))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  if (auto * ex = dynamic_cast<OCallExpr *>(aexpr))
+  {
+    return EvalCall(ex, rvalue);
+  }
+
+  return Unsupported("This expression");
+}
+
+bool OConstEvaluator::IntBinOp(EBinOp aop, OType * atype, OConstEvalValue & aleft, OConstEvalValue & aright,
+                               OConstEvalValue & rvalue)
+{
+  // the integer arithmetic always wraps around at compile time
+  auto *    inttype = static_cast<OTypeInt *>(atype);
+  uint64_t  a = uint64_t(aleft.ivalue);
+  uint64_t  b = uint64_t(aright.ivalue);
+  uint64_t  r;
+
+  if ((BINOP_IDIV == aop) or (BINOP_IMOD == aop))
+  {
+    if (0 == b)
+    {
+      if (emit_errors)
+      {
+        g_compiler->Error(DQERR_CONSTEVAL_DIV_ZERO, FuncName());
+      }
+      return false;
+    }
+
+    if (inttype->issigned)
+    {
+      if (-1 == aright.ivalue)  // avoid the INT64_MIN / -1 overflow trap of the host
+      {
+        r = (BINOP_IDIV == aop ? 0 - a : 0);
+      }
+      else
+      {
+        r = uint64_t(BINOP_IDIV == aop ? aleft.ivalue / aright.ivalue : aleft.ivalue % aright.ivalue);
+      }
+    }
+    else
+    {
+      r = (BINOP_IDIV == aop ? a / b : a % b);
+    }
+  }
+  else if (BINOP_ADD  == aop)  r = a + b;
+  else if (BINOP_SUB  == aop)  r = a - b;
+  else if (BINOP_MUL  == aop)  r = a * b;
+  else if (BINOP_IAND == aop)  r = (a & b);
+  else if (BINOP_IOR  == aop)  r = (a | b);
+  else if (BINOP_IXOR == aop)  r = (a ^ b);
+  else if (BINOP_ISHL == aop)  r = (a << (b & 63));
+  else if (BINOP_ISHR == aop)
+  {
+    r = (inttype->issigned ? uint64_t(aleft.ivalue >> (b & 63)) : (a >> (b & 63)));
+  }
+  else
+  {
+    return Unsupported(format("The operation \"{}\" for \"{}\"", GetBinopSymbol(aop), atype->name));
+  }
+
+  rvalue.ptype = atype;
+  rvalue.ivalue = NormalizeIntConstant(inttype, r);
+  return true;
+}
+
+bool OConstEvaluator::FloatBinOp(EBinOp aop, OType * atype, OConstEvalValue & aleft, OConstEvalValue & aright,
+                                 OConstEvalValue & rvalue)
+{
+  double r;
+  if      (BINOP_ADD == aop)  r = aleft.fvalue + aright.fvalue;
+  else if (BINOP_SUB == aop)  r = aleft.fvalue - aright.fvalue;
+  else if (BINOP_MUL == aop)  r = aleft.fvalue * aright.fvalue;
+  else if (BINOP_DIV == aop)  r = aleft.fvalue / aright.fvalue;
+  else
+  {
+    return Unsupported(format("The operation \"{}\" for \"{}\"", GetBinopSymbol(aop), atype->name));
+  }
+
+  rvalue.ptype = atype;
+  rvalue.fvalue = (4 == atype->bytesize ? double(float(r)) : r);  // float32 rounding like at runtime
+  return true;
+}
+
+bool OConstEvaluator::Compare(ECompareOp aop, OConstEvalValue & aleft, OConstEvalValue & aright, OConstEvalValue & rvalue)
+{
+  OType * optype = aleft.ptype;
+  int     cmp;  // -1, 0, 1
+
+  if (TK_FLOAT == optype->kind)
+  {
+    if (aleft.fvalue != aleft.fvalue or aright.fvalue != aright.fvalue)  // NaN: only <> is true
+    {
+      rvalue.ptype = g_builtins->type_bool;
+      rvalue.ivalue = (COMPOP_NE == aop ? 1 : 0);
+      return true;
+    }
+    cmp = (aleft.fvalue < aright.fvalue ? -1 : (aleft.fvalue > aright.fvalue ? 1 : 0));
+  }
+  else if ((TK_INT == optype->kind) and not static_cast<OTypeInt *>(optype)->issigned)
+  {
+    uint64_t a = uint64_t(aleft.ivalue);
+    uint64_t b = uint64_t(aright.ivalue);
+    cmp = (a < b ? -1 : (a > b ? 1 : 0));
+  }
+  else if ((TK_INT == optype->kind) or (TK_BOOL == optype->kind))
+  {
+    cmp = (aleft.ivalue < aright.ivalue ? -1 : (aleft.ivalue > aright.ivalue ? 1 : 0));
+  }
+  else
+  {
+    return Unsupported(format("The comparison of \"{}\"", optype->name));
+  }
+
+  bool r;
+  if      (COMPOP_EQ == aop)  r = (cmp == 0);
+  else if (COMPOP_NE == aop)  r = (cmp != 0);
+  else if (COMPOP_LT == aop)  r = (cmp <  0);
+  else if (COMPOP_LE == aop)  r = (cmp <= 0);
+  else if (COMPOP_GT == aop)  r = (cmp >  0);
+  else                        r = (cmp >= 0);
+
+  rvalue.ptype = g_builtins->type_bool;
+  rvalue.ivalue = (r ? 1 : 0);
+  return true;
+}
+
+bool OConstEvaluator::Convert(OConstEvalValue & rvalue, OType * adsttype)
+{
+  OType * dsttype = adsttype->ResolveAlias();
+  OType * srctype = rvalue.ptype;
+  if (dsttype == srctype)
+  {
+    return true;
+  }
+
+  if (TK_INT == dsttype->kind)
+  {
+    auto * inttype = static_cast<OTypeInt *>(dsttype);
+    if (TK_FLOAT == srctype->kind)
+    {
+      rvalue.ivalue = (inttype->issigned ? NormalizeIntConstant(inttype, uint64_t(int64_t(rvalue.fvalue)))
+                                         : NormalizeIntConstant(inttype, uint64_t(rvalue.fvalue)));
+    }
+    else if ((TK_INT == srctype->kind) or (TK_BOOL == srctype->kind))
+    {
+      rvalue.ivalue = NormalizeIntConstant(inttype, uint64_t(rvalue.ivalue));
+    }
+    else
+    {
+      return Unsupported(format("The conversion from \"{}\" to \"{}\"", srctype->name, dsttype->name));
+    }
+  }
+  else if (TK_FLOAT == dsttype->kind)
+  {
+    if (TK_INT == srctype->kind)
+    {
+      rvalue.fvalue = (static_cast<OTypeInt *>(srctype)->issigned ? double(rvalue.ivalue) : double(uint64_t(rvalue.ivalue)));
+    }
+    else if (TK_FLOAT != srctype->kind)
+    {
+      return Unsupported(format("The conversion from \"{}\" to \"{}\"", srctype->name, dsttype->name));
+    }
+    if (4 == dsttype->bytesize)
+    {
+      rvalue.fvalue = double(float(rvalue.fvalue));
+    }
+  }
+  else if (TK_BOOL == dsttype->kind)
+  {
+    if ((TK_INT != srctype->kind) and (TK_BOOL != srctype->kind))
+    {
+      return Unsupported(format("The conversion from \"{}\" to \"{}\"", srctype->name, dsttype->name));
+    }
+    rvalue.ivalue = (rvalue.ivalue ? 1 : 0);
+  }
+  else if ((TK_ARRAY == dsttype->kind) and (TK_ARRAY == srctype->kind)
+           and (static_cast<OTypeArray *>(dsttype)->arraylength == rvalue.elements.size()))
+  {
+    OType * elemtype = static_cast<OTypeArray *>(dsttype)->elemtype;
+    for (OConstEvalValue & elem : rvalue.elements)
+    {
+      if (not Convert(elem, elemtype))
+      {
+        return false;
+      }
+    }
+  }
+  else
+  {
+    return Unsupported(format("The conversion from \"{}\" to \"{}\"", srctype->name, dsttype->name));
+  }
+
+  rvalue.ptype = dsttype;
+  return true;
+}
+
+bool OConstEvaluator::InitZero(OConstEvalValue & rvalue, OType * atype)
+{
+  OType * rtype = atype->ResolveAlias();
+  rvalue.ptype = rtype;
+  rvalue.ivalue = 0;
+  rvalue.fvalue = 0.0;
+  rvalue.elements.clear();
+
+  if ((TK_INT == rtype->kind) or (TK_FLOAT == rtype->kind) or (TK_BOOL == rtype->kind))
+  {
+    return true;
+  }
+
+  if (TK_ARRAY == rtype->kind)
+  {
+    auto * arrtype = static_cast<OTypeArray *>(rtype);
+    rvalue.elements.resize(arrtype->arraylength);
+    for (OConstEvalValue & elem : rvalue.elements)
+    {
+      if (not InitZero(elem, arrtype->elemtype))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  return Unsupported(format("The type \"{}\"", rtype->name));
+}
+
+bool OConstEvaluator::FromConstValue(OValue * avalue, OConstEvalValue & rvalue)
+{
+  rvalue.ptype = avalue->ResolvedType();
+
+  if (auto * v = dynamic_cast<OValueInt *>(avalue))
+  {
+    rvalue.ivalue = v->value;
+    return true;
+  }
+  if (auto * v = dynamic_cast<OValueFloat *>(avalue))
+  {
+    rvalue.fvalue = v->value;
+    return true;
+  }
+  if (auto * v = dynamic_cast<OValueBool *>(avalue))
+  {
+    rvalue.ivalue = (v->value ? 1 : 0);
+    return true;
+  }
+  if (auto * v = dynamic_cast<OValueArray *>(avalue))
+  {
+    rvalue.elements.resize(v->elements.size());
+    for (size_t i = 0; i < v->elements.size(); ++i)
+    {
+      if (not FromConstValue(v->elements[i], rvalue.elements[i]))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  return Unsupported(format("The constant of type \"{}\"", rvalue.ptype->name));
+}
+
+OExpr * OConstEvaluator::CreateLiteral(OConstEvalValue & avalue)
+{
+  OType * rtype = avalue.ptype;
+  if (not rtype)  // void function
+  {
+    Unsupported("The call without result");
+    return nullptr;
+  }
+
+  if (TK_INT == rtype->kind)    return new OIntLit(avalue.ivalue, rtype);
+  if (TK_FLOAT == rtype->kind)  return new OFloatLit(avalue.fvalue, rtype);
+  if (TK_BOOL == rtype->kind)   return new OBoolLit(avalue.ivalue != 0, rtype);
+
+  vector<OExpr *> elems;
+  elems.reserve(avalue.elements.size());
+  for (OConstEvalValue & elem : avalue.elements)
+  {
+    elems.push_back(CreateLiteral(elem));
+  }
+  OArrayLit * result = new OArrayLit(elems);
+  result->ptype = rtype;
+  return result;
+}
+
+bool OConstEvaluator::CountStep()
+{
+  if (++steps <= max_steps)
+  {
+    return true;
+  }
+
+  if (emit_errors)
+  {
+    g_compiler->Error(DQERR_CONSTEVAL_LIMIT, FuncName(), format("step limit ({})", max_steps));
+  }
+  return false;
+}
+
+bool OConstEvaluator::Unsupported(const string & awhat)
+{
+  if (emit_errors)
+  {
+    g_compiler->Error(DQERR_CONSTEVAL_UNSUPPORTED, awhat, FuncName());
+  }
+  return false;
+}
+
+string OConstEvaluator::FuncName()
+{
+  return (curfunc ? curfunc : topfunc)->name;
+}
+
+//--------------------------------------
+
+OExpr * ConstEvalCall(OCallExpr * acall, bool emit_errors)
+{
+  OConstEvaluator evaluator(emit_errors);
+  return evaluator.EvaluateCall(acall);
+}
+
+bool CalculateConstEvalCall(OValue * avalue, OCallExpr * acall, bool emit_errors)
+{
+  OExpr * litexpr = ConstEvalCall(acall, emit_errors);
+  if (not litexpr)
+  {
+    return false;
+  }
+
+  bool result = avalue->CalculateConstant(litexpr, emit_errors);
+  OExpr::DeleteTree(litexpr);
+  return result;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    consteval.h
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   compile-time evaluation of the [[consteval]] functions
+ */
+
+#pragma once
+
+#include <vector>
+#include <map>
+#include "symbols.h"
+#include "statements.h"
+
+using namespace std;
+
+class OValSymFunc;
+
+// The [[consteval]] functions are interpreted on the AST when they are called in constant expressions
+// (const declarations, global variable initializers, default arguments) or with constant arguments.
+// Supported: int, float, bool and fixed array values, local variables, while / for / if, recursion.
+// The functions are also compiled normally, so they can be called at runtime too.
+
+class OConstEvalValue
+{
+public:
+  OType *                  ptype = nullptr;  // resolved type
+  int64_t                  ivalue = 0;       // int, bool
+  double                   fvalue = 0.0;
+  vector<OConstEvalValue>  elements;         // fixed array
+};
+
+enum EConstEvalFlow
+{
+  CEFLOW_NEXT = 0,
+  CEFLOW_RETURN,
+  CEFLOW_ERROR
+};
+
+class OConstEvaluator
+{
+public:
+  static constexpr uint64_t  max_steps = 1000000;   // executed statements and loop iterations
+  static constexpr int       max_depth = 256;       // nested calls
+
+  bool             emit_errors;
+  uint64_t         steps = 0;
+  int              depth = 0;
+  OValSymFunc *    topfunc = nullptr;
+  OValSymFunc *    curfunc = nullptr;
+
+  map<OValSym *, OConstEvalValue> *       locals = nullptr;  // variables of the current call
+  map<OValSymConst *, OConstEvalValue>    consts;            // converted constant symbols
+
+  OConstEvaluator(bool aemit_errors)
+  :
+    emit_errors(aemit_errors)
+  {
+  }
+
+  OExpr *  EvaluateCall(OCallExpr * acall);  // returns a literal expression tree or nullptr
+
+protected:
+  bool             CallFunc(OValSymFunc * avsfunc, vector<OConstEvalValue> & aargs, OConstEvalValue & rresult);
+  EConstEvalFlow   ExecBlock(OStmtBlock * ablock);
+  EConstEvalFlow   ExecStatement(OStmt * astmt);
+  bool             EvalExpr(OExpr * aexpr, OConstEvalValue & rvalue);
+  bool             EvalCall(OCallExpr * acall, OConstEvalValue & rvalue);
+  OConstEvalValue *  EvalRef(OLValueExpr * alvalue, bool awrite);
+
+  bool             IntBinOp(EBinOp aop, OType * atype, OConstEvalValue & aleft, OConstEvalValue & aright, OConstEvalValue & rvalue);
+  bool             FloatBinOp(EBinOp aop, OType * atype, OConstEvalValue & aleft, OConstEvalValue & aright, OConstEvalValue & rvalue);
+  bool             Compare(ECompareOp aop, OConstEvalValue & aleft, OConstEvalValue & aright, OConstEvalValue & rvalue);
+
+  bool             Convert(OConstEvalValue & rvalue, OType * adsttype);
+  bool             InitZero(OConstEvalValue & rvalue, OType * atype);
+  bool             FromConstValue(OValue * avalue, OConstEvalValue & rvalue);
+  OExpr *          CreateLiteral(OConstEvalValue & avalue);
+
+  bool             CountStep();
+  bool             Unsupported(const string & awhat);
+  string           FuncName();
+};
+
+// Evaluates the [[consteval]] function call, the result is a literal expression tree
+// (OIntLit, OFloatLit, OBoolLit, OArrayLit) owned by the caller
+OExpr * ConstEvalCall(OCallExpr * acall, bool emit_errors = true);
+
+// OValue::CalculateConstant() helper for the [[consteval]] calls
+bool CalculateConstEvalCall(OValue * avalue, OCallExpr * acall, bool emit_errors);
@@ -13,7 +13,7 @@
 
 #include "dq_module.h"
 
-OModule *  g_module = nullptr;
+thread_local OModule *  g_module = nullptr;
 
 void init_dq_module()
 {
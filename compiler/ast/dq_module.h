@@ -26,7 +26,7 @@ enum EDeclKind
   DK_VALSYM
 };
 
-class ODecl  // module top level declaration
+class ODecl : public OArenaObj  // module top level declaration
 {
 public:
   EDeclKind   kind;
@@ -94,6 +94,6 @@ public:
   bool ValSymDeclared(const string aname, OValSym ** rvalsym = nullptr);
 };
 
-extern OModule *  g_module;
+extern thread_local OModule *  g_module;
 
 void init_dq_module();
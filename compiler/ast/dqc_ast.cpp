@@ -20,6 +20,7 @@
 #include "otype_float.h"
 #include "otype_func.h"
 #include "otype_int.h"
+#include "otype_vector.h"
 
 static bool IsPointerWidthIntegerType(OType * type)
 {
@@ -263,7 +264,7 @@ void ODqCompAst::CollectIgnoredPlainAssignVars(OLValueExpr * leftexpr, vector<OL
       return;
     }
 
-    if (TK_ARRAY == containertype->kind)
+    if ((TK_ARRAY == containertype->kind) or (TK_VECTOR == containertype->kind))
     {
       CollectIgnoredPlainAssignVars(indexref->base, ignored);
       return;
@@ -468,6 +469,11 @@ OExpr * ODqCompAst::CreateBinExpr(EBinOp op, OExpr * left, OExpr * right)
   ETypeKind tkl = left->ptype->kind;
   ETypeKind tkr = right->ptype->kind;
 
+  if (left->IsVector() or right->IsVector())
+  {
+    return CreateVectorBinExpr(op, left, right);
+  }
+
   if ((op >= BINOP_IAND) and (op <= BINOP_ISHR))
   {
     if ((tkl != TK_INT) or (tkr != TK_INT))
@@ -513,6 +519,279 @@ OExpr * ODqCompAst::CreateBinExpr(EBinOp op, OExpr * left, OExpr * right)
   return new OBinExpr(op, newleft, newright);
 }
 
+bool ODqCompAst::CheckVectorBinOp(EBinOp op, OTypeVector * avectype)
+{
+  bool valid;
+  if (avectype->IsMask())
+  {
+    valid = ((BINOP_IAND == op) or (BINOP_IOR == op) or (BINOP_IXOR == op));
+  }
+  else if (avectype->IsFloat())
+  {
+    valid = ((op >= BINOP_ADD) and (op <= BINOP_DIV));
+  }
+  else
+  {
+    valid = (BINOP_DIV != op);  // the integer vectors are divided with IDIV
+  }
+
+  if (!valid)
+  {
+    Error(DQERR_OP_INVALID_FOR, GetBinopSymbol(op), avectype->name);
+  }
+  return valid;
+}
+
+// the operands are not modified, so the callers can still free them on errors
+OTypeVector * ODqCompAst::GetVectorOperandType(OExpr * left, OExpr * right)
+{
+  OType * lefttype = left->ResolvedType();
+  OType * righttype = right->ResolvedType();
+  if (!lefttype || !righttype)
+  {
+    return nullptr;
+  }
+
+  if ((TK_VECTOR == lefttype->kind) and (TK_VECTOR == righttype->kind))
+  {
+    return ((lefttype == righttype) ? static_cast<OTypeVector *>(lefttype) : nullptr);
+  }
+
+  // the scalar operand is broadcasted to all lanes
+  OType * vectype = ((TK_VECTOR == lefttype->kind) ? lefttype : righttype);
+  OExpr * scalar  = ((TK_VECTOR == lefttype->kind) ? right : left);
+  if (GetAssignTypeConversionCost(vectype, scalar) < 0)
+  {
+    return nullptr;
+  }
+  return static_cast<OTypeVector *>(vectype);
+}
+
+void ODqCompAst::HarmonizeVectorOperands(OTypeVector * avectype, OExpr ** rleft, OExpr ** rright)
+{
+  ConvertExprToType(avectype, rleft);
+  ConvertExprToType(avectype, rright);
+}
+
+OExpr * ODqCompAst::CreateVectorBinExpr(EBinOp op, OExpr * left, OExpr * right)
+{
+  OTypeVector * vectype = GetVectorOperandType(left, right);
+  if (!vectype)
+  {
+    Error(DQERR_TYPEMISM_FOR_OP, left->ptype->name, GetBinopSymbol(op), right->ptype->name);
+    return nullptr;
+  }
+
+  if (!CheckVectorBinOp(op, vectype))
+  {
+    return nullptr;
+  }
+
+  HarmonizeVectorOperands(vectype, &left, &right);
+  return new OBinExpr(op, left, right);
+}
+
+OExpr * ODqCompAst::CreateVectorCompareExpr(ECompareOp op, OExpr * left, OExpr * right)
+{
+  OTypeVector * vectype = GetVectorOperandType(left, right);
+  if (!vectype)
+  {
+    Error(DQERR_TYPEMISM_FOR_OP, left->ptype->name, GetCompareSymbol(op), right->ptype->name);
+    return FreeLeftRight(left, right);
+  }
+
+  if (vectype->IsMask() and (COMPOP_EQ != op) and (COMPOP_NE != op))
+  {
+    Error(DQERR_OP_INVALID_FOR, GetCompareSymbol(op), vectype->name);
+    return FreeLeftRight(left, right);
+  }
+
+  HarmonizeVectorOperands(vectype, &left, &right);
+  return new OCompareExpr(op, left, right);  // results a lane mask
+}
+
+bool ODqCompAst::ConvertExprToVector(OType * dsttype, OExpr ** rexpr, uint32_t aflags)
+{
+  OExpr * src = *rexpr;
+  OType * resolved_dst = dsttype->ResolveAlias();
+  OType * resolved_src = src->ResolvedType();
+  bool is_explicit_cast = (aflags & EXPCF_EXPLICIT_CAST);
+
+  if (TK_VECTOR != resolved_dst->kind)
+  {
+    if (aflags & EXPCF_GENERATE_ERRORS)
+    {
+      if (is_explicit_cast)
+      {
+        Error(DQERR_CAST_INVALID, resolved_src->name, resolved_dst->name);
+      }
+      else
+      {
+        Error(DQERR_TYPEMISM_STMT_ASSIGN, "Assignment", resolved_dst->name, resolved_src->name);
+      }
+    }
+    return false;
+  }
+
+  OTypeVector * vecdst = static_cast<OTypeVector *>(resolved_dst);
+
+  if (resolved_dst == resolved_src)
+  {
+    return true;
+  }
+
+  if (TK_VECTOR == resolved_src->kind)
+  {
+    // lane-wise conversions are allowed only explicitly, e.g. float32x8(intvec)
+    OTypeVector * vecsrc = static_cast<OTypeVector *>(resolved_src);
+    if (!is_explicit_cast)
+    {
+      if (aflags & EXPCF_GENERATE_ERRORS)
+      {
+        Error(DQERR_TYPEMISM_STMT_ASSIGN, "Assignment", resolved_dst->name, resolved_src->name);
+      }
+      return false;
+    }
+
+    if (vecdst->lanes != vecsrc->lanes)
+    {
+      if (aflags & EXPCF_GENERATE_ERRORS)
+      {
+        Error(DQERR_VEC_LANES_MISM, resolved_dst->name, resolved_src->name);
+      }
+      return false;
+    }
+
+    if (!vecdst->IsFloat() and vecsrc->IsFloat())
+    {
+      if (aflags & EXPCF_GENERATE_ERRORS)
+      {
+        Error(DQERR_CAST_FLOAT_TO_INT, resolved_src->name, resolved_dst->name);
+      }
+      return false;
+    }
+
+    if (vecdst->IsMask() or (vecdst->IsFloat() and vecsrc->IsMask()))
+    {
+      if (aflags & EXPCF_GENERATE_ERRORS)
+      {
+        Error(DQERR_CAST_INVALID, resolved_src->name, resolved_dst->name);
+      }
+      return false;
+    }
+
+    *rexpr = new OExprTypeConv(dsttype, src);
+    return true;
+  }
+
+  // vector literal: [1, 2, 3, 4]
+  if (auto * arrlit = dynamic_cast<OArrayLit *>(src))
+  {
+    if (arrlit->elements.size() != vecdst->lanes)
+    {
+      if (aflags & EXPCF_GENERATE_ERRORS)
+      {
+        Error(DQERR_ARR_ELEMCOUNT_MISM, to_string(vecdst->lanes), to_string(arrlit->elements.size()));
+      }
+      return false;
+    }
+
+    for (OExpr *& elem : arrlit->elements)
+    {
+      if (!ConvertExprToType(vecdst->elemtype, &elem, aflags & EXPCF_GENERATE_ERRORS))
+      {
+        return false;
+      }
+    }
+
+    *rexpr = new OExprTypeConv(dsttype, src);
+    return true;
+  }
+
+  // scalar broadcast
+  ETypeKind tks = resolved_src->kind;
+  if ((TK_INT == tks) or (TK_FLOAT == tks) or (TK_BOOL == tks))
+  {
+    if (!ConvertExprToType(vecdst->elemtype, &src, aflags))
+    {
+      return false;
+    }
+
+    *rexpr = new OExprTypeConv(dsttype, src);
+    return true;
+  }
+
+  if (aflags & EXPCF_GENERATE_ERRORS)
+  {
+    if (is_explicit_cast)
+    {
+      Error(DQERR_CAST_INVALID, resolved_src->name, resolved_dst->name);
+    }
+    else
+    {
+      Error(DQERR_TYPEMISM_STMT_ASSIGN, "Assignment", resolved_dst->name, resolved_src->name);
+    }
+  }
+  return false;
+}
+
+int ODqCompAst::GetVectorConversionCost(OType * dsttype, OExpr * expr, uint32_t aflags)
+{
+  OType * resolved_dst = dsttype->ResolveAlias();
+  OType * resolved_src = expr->ResolvedType();
+
+  if (TK_VECTOR != resolved_dst->kind)
+  {
+    return -1;
+  }
+
+  if (resolved_dst == resolved_src)
+  {
+    return 0;
+  }
+
+  OTypeVector * vecdst = static_cast<OTypeVector *>(resolved_dst);
+
+  if (TK_VECTOR == resolved_src->kind)
+  {
+    OTypeVector * vecsrc = static_cast<OTypeVector *>(resolved_src);
+    if (!(aflags & EXPCF_EXPLICIT_CAST)
+        or (vecdst->lanes != vecsrc->lanes)
+        or (!vecdst->IsFloat() and vecsrc->IsFloat())
+        or vecdst->IsMask()
+        or (vecdst->IsFloat() and vecsrc->IsMask()))
+    {
+      return -1;
+    }
+    return 1;
+  }
+
+  if (auto * arrlit = dynamic_cast<OArrayLit *>(expr))
+  {
+    if (arrlit->elements.size() != vecdst->lanes)
+    {
+      return -1;
+    }
+
+    for (OExpr * elem : arrlit->elements)
+    {
+      if (GetAssignTypeConversionCost(vecdst->elemtype, elem) < 0)
+      {
+        return -1;
+      }
+    }
+    return 1;
+  }
+
+  ETypeKind tks = resolved_src->kind;
+  if ((TK_INT == tks) or (TK_FLOAT == tks) or (TK_BOOL == tks))
+  {
+    return ((GetAssignTypeConversionCost(vecdst->elemtype, expr, aflags) < 0) ? -1 : 1);
+  }
+
+  return -1;
+}
+
 bool ODqCompAst::ConvertExprToType(OType * dsttype, OExpr ** rexpr, uint32_t aflags)
 {
   OExpr * src = (rexpr ? *rexpr : nullptr);
@@ -540,6 +819,11 @@ bool ODqCompAst::ConvertExprToType(OType * dsttype, OExpr ** rexpr, uint32_t afl
   ETypeKind tks = resolved_src->kind;
   bool is_explicit_cast = (aflags & EXPCF_EXPLICIT_CAST);
 
+  if ((TK_VECTOR == tkd) or (TK_VECTOR == tks))
+  {
+    return ConvertExprToVector(dsttype, rexpr, aflags);
+  }
+
   if (tkd != tks)
   {
     if (TK_FUNCREF == tkd)
@@ -951,6 +1235,11 @@ int ODqCompAst::GetAssignTypeConversionCost(OType * dsttype, OExpr * expr, uint3
   ETypeKind tks = resolved_src->kind;
   bool is_explicit_cast = (aflags & EXPCF_EXPLICIT_CAST);
 
+  if ((TK_VECTOR == tkd) or (TK_VECTOR == tks))
+  {
+    return GetVectorConversionCost(dsttype, expr, aflags);
+  }
+
   if (tkd != tks)
   {
     if (TK_FUNCREF == tkd)
@@ -56,6 +56,8 @@ public:
   OValSym * GetAssignRootValSym(OLValueExpr * leftexpr);
   OExpr * FreeLeftRight(OExpr * left, OExpr * right);
   OExpr * CreateBinExpr(EBinOp op, OExpr * left, OExpr * right);
+  OExpr * CreateVectorCompareExpr(ECompareOp op, OExpr * left, OExpr * right);
+  bool    CheckVectorBinOp(EBinOp op, OTypeVector * avectype);
   bool    ConvertExprToType(OType * dsttype, OExpr ** rexpr, uint32_t aflags = 0);
   int     GetAssignTypeConversionCost(OType * dsttype, OExpr * expr, uint32_t aflags = 0);
   bool    ResolveIifType(OExpr ** rtrueexpr, OExpr ** rfalseexpr, OType ** rresulttype);
@@ -64,6 +66,11 @@ public:
 protected:
   void    PrepareFuncDecl(OScPosition & scpos, OValSymFunc * avsfunc);
   bool    HarmonizeNumericOperands(OExpr ** rleft, OExpr ** rright);
+  OTypeVector * GetVectorOperandType(OExpr * left, OExpr * right);
+  void    HarmonizeVectorOperands(OTypeVector * avectype, OExpr ** rleft, OExpr ** rright);
+  OExpr * CreateVectorBinExpr(EBinOp op, OExpr * left, OExpr * right);
+  bool    ConvertExprToVector(OType * dsttype, OExpr ** rexpr, uint32_t aflags);
+  int     GetVectorConversionCost(OType * dsttype, OExpr * expr, uint32_t aflags);
   bool    ResolveCommonPointerType(OExpr * leftexpr, OExpr * rightexpr, OType ** rresulttype);
   bool    ResolveCommonFuncRefType(OExpr * leftexpr, OExpr * rightexpr, OType ** rresulttype);
 
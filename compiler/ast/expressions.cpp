@@ -19,7 +19,11 @@
 #include "otype_array.h"
 #include "otype_cstring.h"
 #include "otype_func.h"
+#include "otype_vector.h"
+#include "statements.h"
 #include <llvm/IR/Intrinsics.h>
+#include <llvm/IR/MDBuilder.h>
+#include "comp_options.h"
 
 string GetBinopSymbol(EBinOp op)
 {
@@ -69,6 +73,18 @@ string GetRoundModeName(ERoundMode mode)
   return format("int({})", int(mode));
 }
 
+string GetVecReduceName(EVecReduceOp op)
+{
+  if (VECRED_ADD == op)  return "vreduce_add";
+  if (VECRED_MUL == op)  return "vreduce_mul";
+  if (VECRED_MIN == op)  return "vreduce_min";
+  if (VECRED_MAX == op)  return "vreduce_max";
+  if (VECRED_ANY == op)  return "vany";
+  if (VECRED_ALL == op)  return "vall";
+
+  return format("int({})", int(op));
+}
+
 static OExpr * FoldScalarExpr(OExpr * expr);
 
 static bool TryFoldScalarReplacement(OExpr * expr, OExpr ** rreplacement)
@@ -199,7 +215,21 @@ LlValue * OLValueVar::GenerateAddress(OScope * scope)
 
   if (VSK_CONST == pvalsym->kind)
   {
-    throw logic_error(std::format("Constant \"{}\" has no addressable storage", pvalsym->name));
+    // constant arrays get read-only storage for the runtime indexing
+    auto * vsconst = dynamic_cast<OValSymConst *>(pvalsym);
+    if (!vsconst or (TK_ARRAY != pvalsym->ResolvedType()->kind))
+    {
+      throw logic_error(std::format("Constant \"{}\" has no addressable storage", pvalsym->name));
+    }
+
+    if (!pvalsym->ll_value)
+    {
+      auto * gv = new llvm::GlobalVariable(*ll_module, pvalsym->ptype->GetLlType(), true, LlLinkType::PrivateLinkage,
+                                           vsconst->pvalue->GetLlConst(), pvalsym->name);
+      gv->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+      pvalsym->ll_value = gv;
+    }
+    return pvalsym->ll_value;
   }
 
   if (!pvalsym->ll_value)
@@ -259,6 +289,12 @@ LlValue * OLValueVar::Generate(OScope * scope)
     return ll_builder.CreateLoad(alloca->getAllocatedType(), pvalsym->ll_value, pvalsym->name);
   }
 
+  if (isa<llvm::Argument>(pvalsym->ll_value) and (pvalsym->ll_value->getType() != ptype->GetLlType()))
+  {
+    // aggregate parameter or sret result behind a hidden pointer
+    return ll_builder.CreateLoad(ptype->GetLlType(), pvalsym->ll_value, pvalsym->name);
+  }
+
   auto * global = dyn_cast<llvm::GlobalVariable>(pvalsym->ll_value);
   if (global)
   {
@@ -323,8 +359,9 @@ void OLValueMember::DeleteChildTree()
   base = nullptr;
 }
 
-/* ctor */ OLValueIndex::OLValueIndex(OLValueExpr * abase, OType * acontainertype, OExpr * aindex)
+/* ctor */ OLValueIndex::OLValueIndex(OScPosition & ascpos, OLValueExpr * abase, OType * acontainertype, OExpr * aindex)
 {
+  scpos         = ascpos;
   base          = abase;
   containertype = acontainertype;
   indexexpr     = aindex;
@@ -341,6 +378,10 @@ void OLValueMember::DeleteChildTree()
   {
     ptype = g_builtins->type_cchar;
   }
+  else if (TK_VECTOR == acontainertype->kind)
+  {
+    ptype = static_cast<OTypeVector *>(acontainertype)->elemtype;
+  }
 }
 
 LlValue * OLValueIndex::GenerateAddress(OScope * scope)
@@ -351,6 +392,11 @@ LlValue * OLValueIndex::GenerateAddress(OScope * scope)
   {
     // Fixed array: GEP with {0, index} into [N x T]
     LlValue * baseaddr = base->GenerateAddress(scope);
+    int64_t arrlen = static_cast<OTypeArray *>(containertype)->arraylength;
+    if (ll_bounds_check and !IndexInRange(arrlen))
+    {
+      GenerateBoundsCheck(ll_index, llvm::ConstantInt::get(LlType::getInt64Ty(ll_ctx), arrlen));
+    }
     LlValue * ll_zero = llvm::ConstantInt::get(LlType::getInt64Ty(ll_ctx), 0);
     return ll_builder.CreateGEP(
         containertype->GetLlType(), baseaddr,
@@ -361,10 +407,29 @@ LlValue * OLValueIndex::GenerateAddress(OScope * scope)
     // Slice: extract pointer from descriptor, then GEP into the data
     LlValue * baseaddr = base->GenerateAddress(scope);
     LlType * ll_slicetype = containertype->GetLlType();
+    if (ll_bounds_check)
+    {
+      LlValue * ll_len_addr = ll_builder.CreateStructGEP(ll_slicetype, baseaddr, 1, "slice.len.addr");
+      GenerateBoundsCheck(ll_index, ll_builder.CreateLoad(LlType::getInt64Ty(ll_ctx), ll_len_addr, "slice.len"));
+    }
     LlValue * ll_ptr_addr = ll_builder.CreateStructGEP(ll_slicetype, baseaddr, 0, "slice.ptr.addr");
     LlValue * ll_ptr = ll_builder.CreateLoad(llvm::PointerType::get(ll_ctx, 0), ll_ptr_addr, "slice.ptr");
     return ll_builder.CreateGEP(ptype->GetLlType(), ll_ptr, {ll_index}, "slice.elem");
   }
+  else if (TK_VECTOR == containertype->kind)
+  {
+    // Vector lane: GEP with {0, index} into <N x T>, the masks are not addressable
+    LlValue * baseaddr = base->GenerateAddress(scope);
+    int64_t lanes = static_cast<OTypeVector *>(containertype)->lanes;
+    if (ll_bounds_check and !IndexInRange(lanes))
+    {
+      GenerateBoundsCheck(ll_index, llvm::ConstantInt::get(LlType::getInt64Ty(ll_ctx), lanes));
+    }
+    LlValue * ll_zero = llvm::ConstantInt::get(LlType::getInt64Ty(ll_ctx), 0);
+    return ll_builder.CreateGEP(
+        containertype->GetLlType(), baseaddr,
+        {ll_zero, ll_index}, "vec.lane");
+  }
   else if (TK_STRING == containertype->kind)
   {
     // CString indexing
@@ -373,6 +438,10 @@ LlValue * OLValueIndex::GenerateAddress(OScope * scope)
     {
       // Sized cstring[N]: GEP into [N x i8] with {0, index}
       LlValue * baseaddr = base->GenerateAddress(scope);
+      if (ll_bounds_check and !IndexInRange(cstrtype->maxlen))
+      {
+        GenerateBoundsCheck(ll_index, llvm::ConstantInt::get(LlType::getInt64Ty(ll_ctx), cstrtype->maxlen));
+      }
       LlValue * ll_zero = llvm::ConstantInt::get(LlType::getInt64Ty(ll_ctx), 0);
       return ll_builder.CreateGEP(
           cstrtype->GetLlType(), baseaddr,
@@ -383,6 +452,11 @@ LlValue * OLValueIndex::GenerateAddress(OScope * scope)
       // Unsized cstring param: extract ptr from descriptor, then GEP
       LlValue * baseaddr = base->GenerateAddress(scope);
       LlType * ll_desctype = cstrtype->GetLlType();
+      if (ll_bounds_check)
+      {
+        LlValue * ll_maxlen_addr = ll_builder.CreateStructGEP(ll_desctype, baseaddr, 1, "cstr.maxlen.addr");
+        GenerateBoundsCheck(ll_index, ll_builder.CreateLoad(LlType::getInt64Ty(ll_ctx), ll_maxlen_addr, "cstr.maxlen"));
+      }
       LlValue * ll_ptr_addr = ll_builder.CreateStructGEP(ll_desctype, baseaddr, 0, "cstr.ptr.addr");
       LlValue * ll_ptr = ll_builder.CreateLoad(llvm::PointerType::get(ll_ctx, 0), ll_ptr_addr, "cstr.ptr");
       return ll_builder.CreateGEP(LlType::getInt8Ty(ll_ctx), ll_ptr, {ll_index}, "cstr.elem");
@@ -392,6 +466,108 @@ LlValue * OLValueIndex::GenerateAddress(OScope * scope)
   throw logic_error("OLValueIndex::GenerateAddress: unsupported container type");
 }
 
+bool OLValueIndex::IndexInRange(int64_t alength)
+{
+  if (auto * intlit = dynamic_cast<OIntLit *>(indexexpr))
+  {
+    return ((intlit->value >= 0) and (intlit->value + access_width <= alength));
+  }
+
+  // for loop variable with a constant range
+  auto * varexpr = dynamic_cast<OLValueVar *>(indexexpr);
+  if (varexpr)
+  {
+    for (SLoopVarRange & range : ll_loopvar_ranges)
+    {
+      if (range.loopvar == varexpr->pvalsym)
+      {
+        return (range.end - 1 + access_width <= alength);
+      }
+    }
+  }
+  return false;
+}
+
+// the failed bounds checks call this function: prints the source position with the index to the stderr, then traps
+static LlFunction * GetBoundsErrorFunc()
+{
+  const char * fname = "__dq_bounds_error";
+  LlFunction * result = ll_module->getFunction(fname);
+  if (result)
+  {
+    return result;
+  }
+
+  LlType * ll_ptrtype = llvm::PointerType::get(ll_ctx, 0);
+  LlType * ll_i64     = LlType::getInt64Ty(ll_ctx);
+  LlType * ll_i32     = LlType::getInt32Ty(ll_ctx);
+  LlFuncType * ft = LlFuncType::get(LlType::getVoidTy(ll_ctx), {ll_ptrtype, ll_i64, ll_i64}, false);
+  result = LlFunction::Create(ft, LlLinkType::InternalLinkage, fname, ll_module);
+  result->setDoesNotReturn();
+  result->setDoesNotThrow();
+  result->addFnAttr(llvm::Attribute::Cold);
+  result->addFnAttr(llvm::Attribute::NoInline);
+
+  // own builder: the insert point and the debug location of the ll_builder belong to the checked function
+  LlBuilder bld(LlBasicBlock::Create(ll_ctx, "entry", result));
+  LlValue * ll_fmt = bld.CreateGlobalString("%s: index %lld is out of bounds (length %lld)\n", ".str");
+  LlValue * ll_pos = result->getArg(0);
+  LlValue * ll_idx = result->getArg(1);
+  LlValue * ll_len = result->getArg(2);
+#if defined(TARGET_WIN)
+  // no dprintf() in the MSVC runtime, the stderr FILE * comes from __acrt_iob_func(2)
+  llvm::FunctionCallee iob_fn = ll_module->getOrInsertFunction("__acrt_iob_func", LlFuncType::get(ll_ptrtype, {ll_i32}, false));
+  LlValue * ll_stderr = bld.CreateCall(iob_fn, {llvm::ConstantInt::get(ll_i32, 2)});
+  llvm::FunctionCallee print_fn = ll_module->getOrInsertFunction("fprintf", LlFuncType::get(ll_i32, {ll_ptrtype, ll_ptrtype}, true));
+  bld.CreateCall(print_fn, {ll_stderr, ll_fmt, ll_pos, ll_idx, ll_len});
+#else
+  llvm::FunctionCallee print_fn = ll_module->getOrInsertFunction("dprintf", LlFuncType::get(ll_i32, {ll_i32, ll_ptrtype}, true));
+  bld.CreateCall(print_fn, {llvm::ConstantInt::get(ll_i32, 2), ll_fmt, ll_pos, ll_idx, ll_len});
+#endif
+  auto trap_fn = llvm::Intrinsic::getOrInsertDeclaration(ll_module, llvm::Intrinsic::trap);
+  bld.CreateCall(trap_fn, {});
+  bld.CreateUnreachable();
+
+  return result;
+}
+
+void OLValueIndex::GenerateBoundsCheck(LlValue * ll_index, LlValue * ll_length)
+{
+  // the negative indexes become huge unsigned values, so one unsigned compare checks both ends
+  LlType * ll_i64 = LlType::getInt64Ty(ll_ctx);
+  OType * idxtype = indexexpr->ResolvedType();
+  bool issigned = ((TK_INT == idxtype->kind) and static_cast<OTypeInt *>(idxtype)->issigned);
+  LlValue * ll_idx64 = ll_builder.CreateIntCast(ll_index, ll_i64, issigned);
+  LlValue * ll_fail;
+  if (access_width > 1)
+  {
+    // idx + width <= len, without overflow: len >= width and idx <= len - width
+    LlValue * ll_width = llvm::ConstantInt::get(ll_i64, access_width);
+    LlValue * ll_short = ll_builder.CreateICmpULT(ll_length, ll_width, "bc.short");
+    LlValue * ll_over = ll_builder.CreateICmpUGT(ll_idx64, ll_builder.CreateSub(ll_length, ll_width), "bc.over");
+    ll_fail = ll_builder.CreateOr(ll_short, ll_over, "bc.fail");
+  }
+  else
+  {
+    ll_fail = ll_builder.CreateICmpUGE(ll_idx64, ll_length, "bc.fail");
+  }
+
+  LlFunction * ll_parent = ll_builder.GetInsertBlock()->getParent();
+  LlBasicBlock * ok_bb = LlBasicBlock::Create(ll_ctx, "bc.ok", ll_parent);
+  LlBasicBlock * fail_bb = LlBasicBlock::Create(ll_ctx, "bc.trap", ll_parent);
+
+  llvm::MDBuilder mdb(ll_ctx);
+  ll_builder.CreateCondBr(ll_fail, fail_bb, ok_bb, mdb.createBranchWeights(1, 1048575));
+
+  ll_builder.SetInsertPoint(fail_bb);
+  string posstr = format("{}:{}", (scpos.scfile ? scpos.scfile->name : string("?")), scpos.line);
+  LlValue * ll_posstr = ll_builder.CreateGlobalString(posstr, ".str");
+  ll_builder.CreateCall(GetBoundsErrorFunc(), {ll_posstr, ll_idx64, ll_length});
+  ll_builder.CreateUnreachable();
+
+  ll_builder.SetInsertPoint(ok_bb);
+}
+
 void OLValueIndex::FoldChildren()
 {
   OExpr * tmp = base;
@@ -430,11 +606,102 @@ void OLValueIndex::DeleteChildTree()
   // ptype is already set to left->ptype which is the pointer type
 }
 
+LlValue * GenerateIntArith(EBinOp aop, LlValue * aleft, LlValue * aright, bool aissigned)
+{
+  if (INTOVF_TRAP != ll_int_overflow)
+  {
+    bool nsw = (aissigned and (INTOVF_NSW == ll_int_overflow));
+    if      (BINOP_ADD == aop)  return ll_builder.CreateAdd(aleft, aright, "", false, nsw);
+    else if (BINOP_SUB == aop)  return ll_builder.CreateSub(aleft, aright, "", false, nsw);
+    else                        return ll_builder.CreateMul(aleft, aright, "", false, nsw);
+  }
+
+  llvm::Intrinsic::ID iid;
+  if      (BINOP_ADD == aop)  iid = (aissigned ? llvm::Intrinsic::sadd_with_overflow : llvm::Intrinsic::uadd_with_overflow);
+  else if (BINOP_SUB == aop)  iid = (aissigned ? llvm::Intrinsic::ssub_with_overflow : llvm::Intrinsic::usub_with_overflow);
+  else                        iid = (aissigned ? llvm::Intrinsic::smul_with_overflow : llvm::Intrinsic::umul_with_overflow);
+
+  LlValue * ll_res = ll_builder.CreateBinaryIntrinsic(iid, aleft, aright);
+  LlValue * ll_ovf = ll_builder.CreateExtractValue(ll_res, {1}, "ovf");
+  if (ll_ovf->getType()->isVectorTy())
+  {
+    ll_ovf = ll_builder.CreateOrReduce(ll_ovf);  // any lane overflowed
+  }
+
+  LlFunction * ll_parent = ll_builder.GetInsertBlock()->getParent();
+  LlBasicBlock * ok_bb = LlBasicBlock::Create(ll_ctx, "ovf.ok", ll_parent);
+  LlBasicBlock * trap_bb = LlBasicBlock::Create(ll_ctx, "ovf.trap", ll_parent);
+
+  llvm::MDBuilder mdb(ll_ctx);
+  ll_builder.CreateCondBr(ll_ovf, trap_bb, ok_bb, mdb.createBranchWeights(1, 1048575));
+
+  ll_builder.SetInsertPoint(trap_bb);
+  auto trap_fn = llvm::Intrinsic::getOrInsertDeclaration(ll_module, llvm::Intrinsic::trap);
+  ll_builder.CreateCall(trap_fn, {});
+  ll_builder.CreateUnreachable();
+
+  ll_builder.SetInsertPoint(ok_bb);
+  return ll_builder.CreateExtractValue(ll_res, {0});
+}
+
+LlValue * GenerateVectorBinOp(EBinOp aop, LlValue * aleft, LlValue * aright, OTypeVector * avectype)
+{
+  OType * elemtype = avectype->elemtype->ResolveAlias();
+
+  if (TK_FLOAT == elemtype->kind)
+  {
+    if      (BINOP_ADD == aop)   return ll_builder.CreateFAdd(aleft, aright);
+    else if (BINOP_SUB == aop)   return ll_builder.CreateFSub(aleft, aright);
+    else if (BINOP_MUL == aop)   return ll_builder.CreateFMul(aleft, aright);
+    else if (BINOP_DIV == aop)   return ll_builder.CreateFDiv(aleft, aright);
+  }
+  else if (TK_BOOL == elemtype->kind)
+  {
+    if      (BINOP_IAND == aop)  return ll_builder.CreateAnd(aleft, aright);
+    else if (BINOP_IOR  == aop)  return ll_builder.CreateOr(aleft, aright);
+    else if (BINOP_IXOR == aop)  return ll_builder.CreateXor(aleft, aright);
+  }
+  else if (TK_INT == elemtype->kind)
+  {
+    bool issigned = static_cast<OTypeInt *>(elemtype)->issigned;
+
+    if ((BINOP_ADD == aop) or (BINOP_SUB == aop) or (BINOP_MUL == aop))
+    {
+      return GenerateIntArith(aop, aleft, aright, issigned);
+    }
+    else if (BINOP_IDIV == aop)  return ( issigned ? ll_builder.CreateSDiv(aleft, aright)
+                                                   : ll_builder.CreateUDiv(aleft, aright) );
+    else if (BINOP_IMOD == aop)  return ( issigned ? ll_builder.CreateSRem(aleft, aright)
+                                                   : ll_builder.CreateURem(aleft, aright) );
+    else if (BINOP_IOR  == aop)  return ll_builder.CreateOr(aleft, aright);
+    else if (BINOP_IAND == aop)  return ll_builder.CreateAnd(aleft, aright);
+    else if (BINOP_IXOR == aop)  return ll_builder.CreateXor(aleft, aright);
+    else if (BINOP_ISHL == aop)  return ll_builder.CreateShl(aleft, aright);
+    else if (BINOP_ISHR == aop)  return ( issigned ? ll_builder.CreateAShr(aleft, aright)
+                                                   : ll_builder.CreateLShr(aleft, aright) );
+  }
+
+  throw logic_error(std::format("GenerateVectorBinOp(): Unhandled binop = {} for \"{}\"", int(aop), avectype->name));
+}
+
 LlValue * OBinExpr::Generate(OScope * scope)
 {
+  if (FPCONTRACT_ON == g_opt.fp_contract)
+  {
+    if (LlValue * ll_fused = GenerateFMulAdd(scope))
+    {
+      return ll_fused;
+    }
+  }
+
   LlValue * ll_left  = left->Generate(scope);
   LlValue * ll_right = right->Generate(scope);
 
+  if (IsVector())
+  {
+    return GenerateVectorBinOp(op, ll_left, ll_right, static_cast<OTypeVector *>(ResolvedType()));
+  }
+
   if (TK_POINTER == ptype->kind)
   {
     // Pointer arithmetic: ptr + int or ptr - int
@@ -452,9 +719,10 @@ LlValue * OBinExpr::Generate(OScope * scope)
   {
     bool issigned = static_cast<OTypeInt *>(ResolvedType())->issigned;
 
-    if      (BINOP_ADD == op)   return ll_builder.CreateAdd(ll_left, ll_right);
-    else if (BINOP_SUB == op)   return ll_builder.CreateSub(ll_left, ll_right);
-    else if (BINOP_MUL == op)   return ll_builder.CreateMul(ll_left, ll_right);
+    if ((BINOP_ADD == op) or (BINOP_SUB == op) or (BINOP_MUL == op))
+    {
+      return GenerateIntArith(op, ll_left, ll_right, issigned);
+    }
     else if (BINOP_IDIV == op)  return ( issigned ? ll_builder.CreateSDiv(ll_left, ll_right)
                                                   : ll_builder.CreateUDiv(ll_left, ll_right) );
     else if (BINOP_IMOD == op)  return ( issigned ? ll_builder.CreateSRem(ll_left, ll_right)
@@ -483,6 +751,49 @@ LlValue * OBinExpr::Generate(OScope * scope)
   }
 }
 
+static bool IsFloatMul(OExpr * aexpr)
+{
+  auto * binexpr = dynamic_cast<OBinExpr *>(aexpr);
+  return (binexpr and (BINOP_MUL == binexpr->op) and (TK_FLOAT == binexpr->ResolvedType()->kind));
+}
+
+// the multiplication feeding the addition in the same expression is fused with the llvm.fmuladd,
+// the separate statements are not contracted (unlike the contract flag of the -ffp-contract=fast)
+LlValue * OBinExpr::GenerateFMulAdd(OScope * scope)
+{
+  if ((TK_FLOAT != ResolvedType()->kind) or ((BINOP_ADD != op) and (BINOP_SUB != op))
+      or ll_builder.getFastMathFlags().allowContract())  // [[fastmath]]
+  {
+    return nullptr;
+  }
+
+  LlValue * ll_a;
+  LlValue * ll_b;
+  LlValue * ll_c;
+  if (IsFloatMul(left))  // a * b + c, a * b - c
+  {
+    auto * mulexpr = static_cast<OBinExpr *>(left);
+    ll_a = mulexpr->left->Generate(scope);
+    ll_b = mulexpr->right->Generate(scope);
+    ll_c = right->Generate(scope);
+    if (BINOP_SUB == op)  ll_c = ll_builder.CreateFNeg(ll_c);
+  }
+  else if (IsFloatMul(right))  // c + a * b, c - a * b
+  {
+    auto * mulexpr = static_cast<OBinExpr *>(right);
+    ll_c = left->Generate(scope);
+    ll_a = mulexpr->left->Generate(scope);
+    ll_b = mulexpr->right->Generate(scope);
+    if (BINOP_SUB == op)  ll_a = ll_builder.CreateFNeg(ll_a);
+  }
+  else
+  {
+    return nullptr;
+  }
+
+  return ll_builder.CreateIntrinsic(llvm::Intrinsic::fmuladd, {ll_a->getType()}, {ll_a, ll_b, ll_c}, nullptr, "fmuladd");
+}
+
 void OBinExpr::FoldChildren()
 {
   OExpr::FoldTree(&left);
@@ -517,7 +828,14 @@ void OBinExpr::DeleteChildTree()
   left  = aleft;
   right = aright;
 
-  ptype = g_builtins->type_bool;
+  if (aleft->IsVector())
+  {
+    ptype = static_cast<OTypeVector *>(aleft->ResolvedType())->GetMaskType();  // lane-wise comparison
+  }
+  else
+  {
+    ptype = g_builtins->type_bool;
+  }
 }
 
 LlValue * OCompareExpr::Generate(OScope * scope)
@@ -525,7 +843,11 @@ LlValue * OCompareExpr::Generate(OScope * scope)
   LlValue * ll_left  = left->Generate(scope);
   LlValue * ll_right = right->Generate(scope);
 
-  OType * optype = left->ptype;
+  OType * optype = left->ResolvedType();
+  if (TK_VECTOR == optype->kind)
+  {
+    optype = static_cast<OTypeVector *>(optype)->elemtype->ResolveAlias();  // the instructions are the same as for scalars
+  }
 
   if (TK_FLOAT == optype->kind)
   {
@@ -538,7 +860,7 @@ LlValue * OCompareExpr::Generate(OScope * scope)
   }
   else if (TK_INT == optype->kind)
   {
-    bool issigned = static_cast<OTypeInt *>(left->ResolvedType())->issigned;
+    bool issigned = static_cast<OTypeInt *>(optype)->issigned;
 
     if      (COMPOP_EQ == op)   return ll_builder.CreateICmpEQ(ll_left, ll_right);
     else if (COMPOP_NE == op)   return ll_builder.CreateICmpNE(ll_left, ll_right);
@@ -557,6 +879,11 @@ LlValue * OCompareExpr::Generate(OScope * scope)
       else if (COMPOP_GE == op)   return ll_builder.CreateICmpUGE(ll_left, ll_right);
     }
   }
+  else if (TK_BOOL == optype->kind)
+  {
+    if      (COMPOP_EQ == op)   return ll_builder.CreateICmpEQ(ll_left, ll_right);
+    else if (COMPOP_NE == op)   return ll_builder.CreateICmpNE(ll_left, ll_right);
+  }
   else if ((TK_POINTER == optype->kind) || (TK_FUNCREF == optype->kind))
   {
     // Pointer comparisons (unsigned — comparing addresses)
@@ -780,7 +1107,7 @@ void ONotExpr::DeleteChildTree()
 {
   operand = expr;
   ptype = operand->ptype;
-  if (TK_INT != ptype->kind)
+  if ((TK_INT != ptype->kind) and !operand->IsVector())
   {
     ptype = g_builtins->type_int;
   }
@@ -824,7 +1151,7 @@ void OBinNotExpr::DeleteChildTree()
 LlValue * ONegExpr::Generate(OScope * scope)
 {
   LlValue * ll_val = operand->Generate(scope);
-  if (ll_val->getType()->isFloatingPointTy())
+  if (ll_val->getType()->isFPOrFPVectorTy())
   {
     return ll_builder.CreateFNeg(ll_val);
   }
@@ -1003,6 +1330,192 @@ void OFloatRoundExpr::DeleteChildTree()
   src = nullptr;
 }
 
+/* ctor */ OVecReduceExpr::OVecReduceExpr(EVecReduceOp aop, OExpr * asrc)
+{
+  op  = aop;
+  src = asrc;
+  if ((VECRED_ANY == op) or (VECRED_ALL == op))
+  {
+    ptype = g_builtins->type_bool;
+  }
+  else
+  {
+    ptype = static_cast<OTypeVector *>(asrc->ResolvedType())->elemtype;
+  }
+}
+
+LlValue * OVecReduceExpr::Generate(OScope * scope)
+{
+  LlValue * ll_src = src->Generate(scope);
+
+  if (VECRED_ANY == op)  return ll_builder.CreateOrReduce(ll_src);
+  if (VECRED_ALL == op)  return ll_builder.CreateAndReduce(ll_src);
+
+  OType * elemtype = ResolvedType();
+  if (TK_FLOAT == elemtype->kind)
+  {
+    // the start values are the neutral elements, -0.0 keeps the sign of a -0.0 sum
+    if (VECRED_ADD == op)  return ll_builder.CreateFAddReduce(llvm::ConstantFP::getNegativeZero(ptype->GetLlType()), ll_src);
+    if (VECRED_MUL == op)  return ll_builder.CreateFMulReduce(llvm::ConstantFP::get(ptype->GetLlType(), 1.0), ll_src);
+    if (VECRED_MIN == op)  return ll_builder.CreateFPMinReduce(ll_src);
+    if (VECRED_MAX == op)  return ll_builder.CreateFPMaxReduce(ll_src);
+  }
+  else if (TK_INT == elemtype->kind)
+  {
+    bool issigned = static_cast<OTypeInt *>(elemtype)->issigned;
+    if (VECRED_ADD == op)  return ll_builder.CreateAddReduce(ll_src);
+    if (VECRED_MUL == op)  return ll_builder.CreateMulReduce(ll_src);
+    if (VECRED_MIN == op)  return ll_builder.CreateIntMinReduce(ll_src, issigned);
+    if (VECRED_MAX == op)  return ll_builder.CreateIntMaxReduce(ll_src, issigned);
+  }
+
+  throw logic_error(std::format("OVecReduceExpr::Generate(): Unhandled {}() for \"{}\"", GetVecReduceName(op), src->ptype->name));
+}
+
+void OVecReduceExpr::FoldChildren()
+{
+  OExpr::FoldTree(&src);
+}
+
+void OVecReduceExpr::DeleteChildTree()
+{
+  OExpr::DeleteTree(src);
+  src = nullptr;
+}
+
+/* ctor */ OVecShuffleExpr::OVecShuffleExpr(OExpr * asrc1, OExpr * asrc2, const vector<int> & aindices)
+{
+  src1    = asrc1;
+  src2    = asrc2;
+  indices = aindices;
+
+  OTypeVector * srctype = static_cast<OTypeVector *>(asrc1->ResolvedType());
+  ptype = srctype->elemtype->GetVectorType(indices.size());
+}
+
+LlValue * OVecShuffleExpr::Generate(OScope * scope)
+{
+  LlValue * ll_src1 = src1->Generate(scope);
+  LlValue * ll_src2 = (src2 ? src2->Generate(scope) : llvm::PoisonValue::get(ll_src1->getType()));
+  return ll_builder.CreateShuffleVector(ll_src1, ll_src2, indices, "shuffle");
+}
+
+void OVecShuffleExpr::FoldChildren()
+{
+  OExpr::FoldTree(&src1);
+  OExpr::FoldTree(&src2);
+}
+
+void OVecShuffleExpr::DeleteChildTree()
+{
+  OExpr::DeleteTree(src1);
+  OExpr::DeleteTree(src2);
+  src1 = nullptr;
+  src2 = nullptr;
+}
+
+/* ctor */ OVecSelectExpr::OVecSelectExpr(OExpr * amask, OExpr * atrue, OExpr * afalse)
+{
+  mask       = amask;
+  true_expr  = atrue;
+  false_expr = afalse;
+  ptype      = atrue->ptype;
+}
+
+LlValue * OVecSelectExpr::Generate(OScope * scope)
+{
+  LlValue * ll_mask  = mask->Generate(scope);
+  LlValue * ll_true  = true_expr->Generate(scope);
+  LlValue * ll_false = false_expr->Generate(scope);
+  return ll_builder.CreateSelect(ll_mask, ll_true, ll_false, "vselect");
+}
+
+void OVecSelectExpr::FoldChildren()
+{
+  OExpr::FoldTree(&mask);
+  OExpr::FoldTree(&true_expr);
+  OExpr::FoldTree(&false_expr);
+}
+
+void OVecSelectExpr::DeleteChildTree()
+{
+  OExpr::DeleteTree(mask);
+  OExpr::DeleteTree(true_expr);
+  OExpr::DeleteTree(false_expr);
+  mask = nullptr;
+  true_expr = nullptr;
+  false_expr = nullptr;
+}
+
+/* ctor */ OVecLoadExpr::OVecLoadExpr(OTypeVector * avectype, OLValueExpr * aelemref)
+{
+  elemref = aelemref;
+  ptype   = avectype;
+
+  if (auto * idxref = dynamic_cast<OLValueIndex *>(aelemref))
+  {
+    idxref->access_width = avectype->lanes;
+  }
+}
+
+LlValue * OVecLoadExpr::Generate(OScope * scope)
+{
+  // the array elements are aligned only to the element size
+  LlValue * ll_addr = elemref->GenerateAddress(scope);
+  llvm::Align elemalign(elemref->ResolvedType()->bytesize);
+  return ll_builder.CreateAlignedLoad(ptype->GetLlType(), ll_addr, elemalign, "vload");
+}
+
+void OVecLoadExpr::FoldChildren()
+{
+  OExpr * tmp = elemref;
+  OExpr::FoldTree(&tmp);
+  elemref = static_cast<OLValueExpr *>(tmp);
+}
+
+void OVecLoadExpr::DeleteChildTree()
+{
+  OExpr::DeleteTree(elemref);
+  elemref = nullptr;
+}
+
+/* ctor */ OVecStoreExpr::OVecStoreExpr(OLValueExpr * aelemref, OExpr * avalue)
+{
+  elemref = aelemref;
+  value   = avalue;
+  ptype   = nullptr;  // no result
+
+  if (auto * idxref = dynamic_cast<OLValueIndex *>(aelemref))
+  {
+    idxref->access_width = static_cast<OTypeVector *>(avalue->ResolvedType())->lanes;
+  }
+}
+
+LlValue * OVecStoreExpr::Generate(OScope * scope)
+{
+  LlValue * ll_value = value->Generate(scope);
+  LlValue * ll_addr = elemref->GenerateAddress(scope);
+  llvm::Align elemalign(elemref->ResolvedType()->bytesize);
+  ll_builder.CreateAlignedStore(ll_value, ll_addr, elemalign);
+  return nullptr;
+}
+
+void OVecStoreExpr::FoldChildren()
+{
+  OExpr * tmp = elemref;
+  OExpr::FoldTree(&tmp);
+  elemref = static_cast<OLValueExpr *>(tmp);
+  OExpr::FoldTree(&value);
+}
+
+void OVecStoreExpr::DeleteChildTree()
+{
+  OExpr::DeleteTree(elemref);
+  OExpr::DeleteTree(value);
+  elemref = nullptr;
+  value = nullptr;
+}
+
 /* ctor */ OCallExpr::OCallExpr(OValSymFunc * avsfunc)
 {
   vsfunc = avsfunc;
@@ -1018,38 +1531,7 @@ LlValue * OCallExpr::Generate(OScope * scope)
   }
 
   OTypeFunc * tfunc = static_cast<OTypeFunc *>(vsfunc->ptype);
-  vector<LlValue *>   ll_args;
-  for (size_t i = 0; i < args.size(); ++i)
-  {
-    LlValue * val = args[i]->Generate(scope);
-
-    // C varargs default argument promotions for extra arguments
-    if (tfunc->has_varargs && i >= tfunc->params.size())
-    {
-      LlType * valtype = val->getType();
-      if (valtype->isFloatTy())
-      {
-        // float32 -> double promotion
-        val = ll_builder.CreateFPExt(val, llvm::Type::getDoubleTy(ll_ctx));
-      }
-      else if (valtype->isIntegerTy() && valtype->getIntegerBitWidth() < 32)
-      {
-        // small integers use the C default argument promotions
-        OTypeInt * inttype = dynamic_cast<OTypeInt *>(args[i]->ResolvedType());
-        if (inttype && inttype->issigned)
-        {
-          val = ll_builder.CreateSExt(val, llvm::Type::getInt32Ty(ll_ctx));
-        }
-        else
-        {
-          val = ll_builder.CreateZExt(val, llvm::Type::getInt32Ty(ll_ctx));
-        }
-      }
-    }
-
-    ll_args.push_back(val);
-  }
-  return ll_builder.CreateCall(ll_func, ll_args);
+  return tfunc->GenerateCall(ll_func, args, scope);
 }
 
 void OCallExpr::FoldChildren()
@@ -1060,6 +1542,17 @@ void OCallExpr::FoldChildren()
   }
 }
 
+bool OCallExpr::TryFoldSelf(OExpr ** rreplacement)
+{
+  if (not vsfunc->attr_consteval or !TryFoldScalarReplacement(this, rreplacement))
+  {
+    return false;
+  }
+
+  DeleteChildTree();
+  return true;
+}
+
 void OCallExpr::DeleteChildTree()
 {
   for (OExpr *& arg : args)
@@ -1134,36 +1627,7 @@ LlValue * OIndirectCallExpr::Generate(OScope * scope)
 
   ll_builder.SetInsertPoint(ok_bb);
 
-  vector<LlValue *> ll_args;
-  for (size_t i = 0; i < args.size(); ++i)
-  {
-    LlValue * val = args[i]->Generate(scope);
-
-    if (sigtype->has_varargs && i >= sigtype->params.size())
-    {
-      LlType * valtype = val->getType();
-      if (valtype->isFloatTy())
-      {
-        val = ll_builder.CreateFPExt(val, llvm::Type::getDoubleTy(ll_ctx));
-      }
-      else if (valtype->isIntegerTy() && valtype->getIntegerBitWidth() < 32)
-      {
-        OTypeInt * inttype = dynamic_cast<OTypeInt *>(args[i]->ResolvedType());
-        if (inttype && inttype->issigned)
-        {
-          val = ll_builder.CreateSExt(val, llvm::Type::getInt32Ty(ll_ctx));
-        }
-        else
-        {
-          val = ll_builder.CreateZExt(val, llvm::Type::getInt32Ty(ll_ctx));
-        }
-      }
-    }
-
-    ll_args.push_back(val);
-  }
-
-  return ll_builder.CreateCall(static_cast<LlFuncType *>(sigtype->GetLlType()), ll_callee, ll_args);
+  return sigtype->GenerateCall(ll_callee, args, scope);
 }
 
 void OIndirectCallExpr::FoldChildren()
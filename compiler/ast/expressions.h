@@ -106,10 +106,16 @@ public:
   OLValueExpr *  base;
   OType *        containertype;  // array, slice, or cstring type
   OExpr *        indexexpr;
-  /* ctor */ OLValueIndex(OLValueExpr * abase, OType * acontainertype, OExpr * aindex);
+  OScPosition    scpos;          // reported by the failed bounds checks
+  uint32_t       access_width = 1;  // consecutive elements touched from the index (vload/vstore lanes)
+  /* ctor */ OLValueIndex(OScPosition & ascpos, OLValueExpr * abase, OType * acontainertype, OExpr * aindex);
   LlValue *  GenerateAddress(OScope * scope) override;
   void       FoldChildren() override;
   void       DeleteChildTree() override;
+
+protected:
+  bool       IndexInRange(int64_t alength);  // the bounds check can be omitted
+  void       GenerateBoundsCheck(LlValue * ll_index, LlValue * ll_length);
 };
 
 enum EBinOp
@@ -129,6 +135,9 @@ enum EBinOp
   BINOP_ISHR
 };
 
+LlValue * GenerateIntArith(EBinOp aop, LlValue * aleft, LlValue * aright, bool aissigned);  // +,-,* with the overflow model
+LlValue * GenerateVectorBinOp(EBinOp aop, LlValue * aleft, LlValue * aright, OTypeVector * avectype);  // lane-wise
+
 string GetBinopSymbol(EBinOp op);
 
 class OBinExpr : public OExpr
@@ -143,6 +152,9 @@ public:
   void       FoldChildren() override;
   bool       TryFoldSelf(OExpr ** rreplacement) override;
   void       DeleteChildTree() override;
+
+protected:
+  LlValue *  GenerateFMulAdd(OScope * scope);  // -ffp-contract=on, nullptr when not a float a * b +- c
 };
 
 enum ECompareOp
@@ -313,6 +325,82 @@ public:
   void        DeleteChildTree() override;
 };
 
+// --- SIMD vector builtins ---
+
+enum EVecReduceOp
+{
+  VECRED_ADD,
+  VECRED_MUL,
+  VECRED_MIN,
+  VECRED_MAX,
+  VECRED_ANY,  // masks only
+  VECRED_ALL   // masks only
+};
+
+string GetVecReduceName(EVecReduceOp op);
+
+// Horizontal reduction: vreduce_add(v), vany(mask), ...
+class OVecReduceExpr : public OExpr
+{
+public:
+  EVecReduceOp  op;
+  OExpr *       src;
+  /* ctor */    OVecReduceExpr(EVecReduceOp aop, OExpr * asrc);
+  LlValue *     Generate(OScope * scope) override;
+  void          FoldChildren() override;
+  void          DeleteChildTree() override;
+};
+
+// Lane permutation with constant indices: vshuffle(a, [3, 2, 1, 0]) or vshuffle(a, b, [0, 4, 1, 5])
+// The indices of the second source start after the lanes of the first one.
+class OVecShuffleExpr : public OExpr
+{
+public:
+  OExpr *       src1;
+  OExpr *       src2;  // optional
+  vector<int>   indices;
+  /* ctor */    OVecShuffleExpr(OExpr * asrc1, OExpr * asrc2, const vector<int> & aindices);
+  LlValue *     Generate(OScope * scope) override;
+  void          FoldChildren() override;
+  void          DeleteChildTree() override;
+};
+
+// Lane-wise selection: vselect(mask, a, b)
+class OVecSelectExpr : public OExpr
+{
+public:
+  OExpr *       mask;
+  OExpr *       true_expr;
+  OExpr *       false_expr;
+  /* ctor */    OVecSelectExpr(OExpr * amask, OExpr * atrue, OExpr * afalse);
+  LlValue *     Generate(OScope * scope) override;
+  void          FoldChildren() override;
+  void          DeleteChildTree() override;
+};
+
+// Loads consecutive array elements into a vector: vload(float32x8, arr[i])
+class OVecLoadExpr : public OExpr
+{
+public:
+  OLValueExpr * elemref;  // address of the first element
+  /* ctor */    OVecLoadExpr(OTypeVector * avectype, OLValueExpr * aelemref);
+  LlValue *     Generate(OScope * scope) override;
+  void          FoldChildren() override;
+  void          DeleteChildTree() override;
+};
+
+// Stores a vector to consecutive array elements: vstore(arr[i], v), used as statement
+class OVecStoreExpr : public OExpr
+{
+public:
+  OLValueExpr * elemref;
+  OExpr *       value;
+  /* ctor */    OVecStoreExpr(OLValueExpr * aelemref, OExpr * avalue);
+  LlValue *     Generate(OScope * scope) override;
+  void          FoldChildren() override;
+  void          DeleteChildTree() override;
+};
+
 class OValSymFunc;  // forward declaration for otype_func.h
 class OTypeFuncRef;
 class OTypeFunc;
@@ -326,6 +414,7 @@ public:
                    ~OCallExpr();
   LlValue *         Generate(OScope * scope) override;
   void              FoldChildren() override;
+  bool              TryFoldSelf(OExpr ** rreplacement) override;  // [[consteval]] calls with constant arguments
   void              DeleteChildTree() override;
 
 public:
@@ -16,6 +16,7 @@
 #include "statements.h"
 #include "otype_array.h"
 #include "otype_cstring.h"
+#include "otype_vector.h"
 #include "comp_options.h"
 
 using namespace std;
@@ -37,7 +38,7 @@ static void GetCStringCopySource(OScope * scope, OExpr * srcexpr, LlValue *& rsr
     }
     else
     {
-      srcaddr = ll_builder.CreateAlloca(srctype->GetLlType(), nullptr, "cstr.src.tmp");
+      srcaddr = ll_create_alloca(srctype->GetLlType(), "cstr.src.tmp");
       ll_builder.CreateStore(srcexpr->Generate(scope), srcaddr);
     }
 
@@ -190,7 +191,7 @@ void OStmtVarDecl::Generate(OScope * scope)
 {
   // Local variable declaration
   LlType * ll_type = variable->GetStorageType()->GetLlType();
-  variable->ll_value = ll_builder.CreateAlloca(ll_type, nullptr, variable->name);
+  variable->ll_value = ll_create_alloca(ll_type, variable->name);
   if (g_opt.dbg_info)
   {
     llvm::DILocalVariable * di_var = di_builder->createAutoVariable(
@@ -224,8 +225,9 @@ void OStmtVarDecl::Generate(OScope * scope)
     }
   }
 
-  // Compound type zero-initialization: var sm : SMain = {};
-  if (TK_COMPOUND == variable->ptype->kind and not initvalue and variable->initialized)
+  // Compound and vector type zero-initialization: var sm : SMain = {};
+  ETypeKind tk = variable->ptype->ResolveAlias()->kind;
+  if (((TK_COMPOUND == tk) or (TK_VECTOR == tk)) and not initvalue and variable->initialized)
   {
     LlConst * ll_zero = llvm::ConstantAggregateZero::get(ll_type);
     ll_builder.CreateStore(ll_zero, variable->ll_value);
@@ -287,6 +289,10 @@ void OStmtModifyAssign::Generate(OScope * scope)
     else if (BINOP_SUB == op)
       ll_newval = ll_builder.CreateGEP(ll_elemtype, ll_curval, {ll_builder.CreateNeg(ll_mod_value)}, "ptr.rev");
   }
+  else if (TK_VECTOR == valtype->ResolveAlias()->kind)
+  {
+    ll_newval = GenerateVectorBinOp(op, ll_curval, ll_mod_value, static_cast<OTypeVector *>(valtype->ResolveAlias()));
+  }
   else if (TK_FLOAT == valtype->kind)
   {
     if      (BINOP_ADD == op)  ll_newval = ll_builder.CreateFAdd(ll_curval, ll_mod_value);
@@ -298,9 +304,10 @@ void OStmtModifyAssign::Generate(OScope * scope)
   {
     bool issigned = static_cast<OTypeInt *>(valtype->ResolveAlias())->issigned;
 
-    if      (BINOP_ADD  == op)  ll_newval = ll_builder.CreateAdd(ll_curval, ll_mod_value);
-    else if (BINOP_SUB  == op)  ll_newval = ll_builder.CreateSub(ll_curval, ll_mod_value);
-    else if (BINOP_MUL  == op)  ll_newval = ll_builder.CreateMul(ll_curval, ll_mod_value);
+    if ((BINOP_ADD == op) or (BINOP_SUB == op) or (BINOP_MUL == op))
+    {
+      ll_newval = GenerateIntArith(op, ll_curval, ll_mod_value, issigned);
+    }
     else if (BINOP_IDIV == op)  ll_newval = ( issigned ? ll_builder.CreateSDiv(ll_curval, ll_mod_value)
                                                        : ll_builder.CreateUDiv(ll_curval, ll_mod_value) );
     else if (BINOP_IMOD == op)  ll_newval = ( issigned ? ll_builder.CreateSRem(ll_curval, ll_mod_value)
@@ -332,6 +339,80 @@ void OStmtVoidCall::Generate(OScope * scope)
   LlValue * ll_value = callexpr->Generate(scope);
 }
 
+thread_local vector<SLoopHintPos>  ll_loop_hint_list;
+thread_local vector<SLoopVarRange> ll_loopvar_ranges;
+
+void OLoopHints::ApplyAttributes(OAttr * aattr)
+{
+  aattr->CheckInvalidAttributes(ATGT_LOOP);
+
+  // a count or width of 1 is the same as disabling the transformation
+  if (aattr->IsSet(ATTF_NO_UNROLL) or (1 == aattr->unroll_count))
+  {
+    unroll = -1;
+  }
+  else if (aattr->IsSet(ATTF_UNROLL))
+  {
+    unroll = (aattr->unroll_count > 1 ? int(aattr->unroll_count) : 1);
+  }
+
+  if (aattr->IsSet(ATTF_NO_VECTORIZE) or (1 == aattr->vectorize_width))
+  {
+    vectorize = -1;
+  }
+  else if (aattr->IsSet(ATTF_VECTORIZE))
+  {
+    vectorize = (aattr->vectorize_width > 1 ? int(aattr->vectorize_width) : 1);
+  }
+
+  if (aattr->IsSet(ATTF_INTERLEAVE))
+  {
+    interleave = int(aattr->interleave_count);
+  }
+}
+
+llvm::MDNode * OLoopHints::CreateLoopMd(OScPosition & ascpos, bool amustprogress)
+{
+  vector<llvm::Metadata *> props;
+
+  auto add_prop = [&props](const char * aname, LlConst * avalue)
+  {
+    vector<llvm::Metadata *> ops;
+    ops.push_back(llvm::MDString::get(ll_ctx, aname));
+    if (avalue)
+    {
+      ops.push_back(llvm::ConstantAsMetadata::get(avalue));
+    }
+    props.push_back(llvm::MDNode::get(ll_ctx, ops));
+  };
+
+  if (unroll < 0)        add_prop("llvm.loop.unroll.disable", nullptr);
+  else if (1 == unroll)  add_prop("llvm.loop.unroll.enable", nullptr);
+  else if (unroll > 1)   add_prop("llvm.loop.unroll.count", ll_builder.getInt32(unroll));
+
+  if (vectorize < 0)
+  {
+    add_prop("llvm.loop.vectorize.width", ll_builder.getInt32(1));
+  }
+  else if (vectorize > 0)
+  {
+    add_prop("llvm.loop.vectorize.enable", ll_builder.getTrue());
+    if (vectorize > 1)
+    {
+      add_prop("llvm.loop.vectorize.width", ll_builder.getInt32(vectorize));
+    }
+  }
+
+  if (interleave > 0)    add_prop("llvm.loop.interleave.count", ll_builder.getInt32(interleave));
+
+  llvm::MDNode * result = ll_loop_metadata(props, amustprogress);
+  if (Present())
+  {
+    ll_loop_hint_list.push_back({result, ll_builder.GetInsertBlock()->getParent(), ascpos});
+  }
+  return result;
+}
+
 void OStmtWhile::Generate(OScope * scope)
 {
   LlFunction *    ll_func    = ll_builder.GetInsertBlock()->getParent();
@@ -339,8 +420,11 @@ void OStmtWhile::Generate(OScope * scope)
   LlBasicBlock *  ll_body_bb = LlBasicBlock::Create(ll_ctx, "while.body", ll_func);
   LlBasicBlock *  ll_end_bb  = LlBasicBlock::Create(ll_ctx, "while.end", ll_func);
 
+  // the while loops might be infinite, so they get no mustprogress, and loop metadata only for the hints
+  llvm::MDNode * ll_loop_md = (hints.Present() ? hints.CreateLoopMd(scpos, false) : nullptr);
+
   // Push loop context for break/continue
-  ll_loop_stack.push_back({ll_cond_bb, ll_end_bb});
+  ll_loop_stack.push_back({ll_cond_bb, ll_end_bb, ll_loop_md});
 
   // Jump to condition check
   ll_builder.CreateBr(ll_cond_bb);
@@ -363,7 +447,11 @@ void OStmtWhile::Generate(OScope * scope)
   // Jump back to condition
   if (!ll_builder.GetInsertBlock()->getTerminator())
   {
-    ll_builder.CreateBr(ll_cond_bb);
+    llvm::BranchInst * ll_back_br = ll_builder.CreateBr(ll_cond_bb);
+    if (ll_loop_md)
+    {
+      ll_back_br->setMetadata(llvm::LLVMContext::MD_loop, ll_loop_md);
+    }
   }
 
   ll_loop_stack.pop_back();
@@ -372,6 +460,76 @@ void OStmtWhile::Generate(OScope * scope)
   ll_builder.SetInsertPoint(ll_end_bb);
 }
 
+void OStmtFor::Generate(OScope * scope)
+{
+  LlFunction *    ll_func         = ll_builder.GetInsertBlock()->getParent();
+  LlBasicBlock *  ll_preheader_bb = LlBasicBlock::Create(ll_ctx, "for.preheader", ll_func);
+  LlBasicBlock *  ll_body_bb      = LlBasicBlock::Create(ll_ctx, "for.body", ll_func);
+  LlBasicBlock *  ll_latch_bb     = LlBasicBlock::Create(ll_ctx, "for.latch", ll_func);
+  LlBasicBlock *  ll_end_bb       = LlBasicBlock::Create(ll_ctx, "for.end", ll_func);
+
+  LlType * ll_type = loopvar->ptype->GetLlType();
+
+  // the range is evaluated only once
+  LlValue * ll_start = startexpr->Generate(scope);
+  LlValue * ll_end   = endexpr->Generate(scope);
+
+  loopvar->ll_value = ll_create_alloca(ll_type, loopvar->name);
+  if (g_opt.dbg_info)
+  {
+    llvm::DILocalVariable * di_var = di_builder->createAutoVariable(
+        body->scope->GetDiScope(), loopvar->name, scpos.scfile->di_file, scpos.line, loopvar->ptype->GetDiType() );
+    di_builder->insertDeclare(loopvar->ll_value, di_var, di_builder->createExpression(),
+        llvm::DILocation::get(ll_ctx, scpos.line, scpos.col, body->scope->GetDiScope()), ll_builder.GetInsertBlock() );
+  }
+  ll_builder.CreateStore(ll_start, loopvar->ll_value);
+
+  // guard for the empty ranges, so the body is entered only when at least one iteration runs
+  LlValue * ll_guard = ll_builder.CreateICmpSLT(ll_start, ll_end, "for.guard");
+  ll_builder.CreateCondBr(ll_guard, ll_preheader_bb, ll_end_bb);
+
+  ll_builder.SetInsertPoint(ll_preheader_bb);
+  ll_builder.CreateBr(ll_body_bb);
+
+  // continue jumps to the latch
+  ll_loop_stack.push_back({ll_latch_bb, ll_end_bb});
+
+  // constant loop variable range for the bounds check elimination, the slice lengths
+  // are left for the optimizer, because the slice variables can be reassigned in the body
+  auto * startlit = dynamic_cast<OIntLit *>(startexpr);
+  auto * endlit   = dynamic_cast<OIntLit *>(endexpr);
+  bool range_known = (startlit and endlit and (startlit->value >= 0));
+  if (range_known)
+  {
+    ll_loopvar_ranges.push_back({loopvar, startlit->value, endlit->value});
+  }
+
+  ll_builder.SetInsertPoint(ll_body_bb);
+  body->Generate();
+  if (!ll_builder.GetInsertBlock()->getTerminator())
+  {
+    ll_builder.CreateBr(ll_latch_bb);
+  }
+
+  if (range_known)
+  {
+    ll_loopvar_ranges.pop_back();
+  }
+  ll_loop_stack.pop_back();
+
+  // the increment can not overflow, because the loop variable is below the end here
+  ll_builder.SetInsertPoint(ll_latch_bb);
+  EmitDebugLocation(scope);
+  LlValue * ll_cur  = ll_builder.CreateLoad(ll_type, loopvar->ll_value, loopvar->name);
+  LlValue * ll_next = ll_builder.CreateNSWAdd(ll_cur, llvm::ConstantInt::get(ll_type, 1), loopvar->name + ".next");
+  ll_builder.CreateStore(ll_next, loopvar->ll_value);
+  LlValue * ll_cond = ll_builder.CreateICmpSLT(ll_next, ll_end, "for.cond");
+  llvm::BranchInst * ll_latch_br = ll_builder.CreateCondBr(ll_cond, ll_body_bb, ll_end_bb);
+  ll_latch_br->setMetadata(llvm::LLVMContext::MD_loop, hints.CreateLoopMd(scpos, true));
+
+  ll_builder.SetInsertPoint(ll_end_bb);
+}
+
 void OBreakStmt::Generate(OScope * scope)
 {
   if (ll_loop_stack.size() < 1)
@@ -389,7 +547,11 @@ void OContinueStmt::Generate(OScope * scope)
     throw logic_error("BreakStmt::Generate(): empty loop_stack!");
   }
 
-  ll_builder.CreateBr(ll_loop_stack.back().cond_bb);
+  llvm::BranchInst * ll_br = ll_builder.CreateBr(ll_loop_stack.back().cond_bb);
+  if (ll_loop_stack.back().loop_md)  // backedge of a hinted while loop
+  {
+    ll_br->setMetadata(llvm::LLVMContext::MD_loop, ll_loop_stack.back().loop_md);
+  }
 }
 
 void OStmtIf::Generate(OScope * scope)
@@ -21,7 +21,7 @@
 
 using namespace std;
 
-class OStmt
+class OStmt : public OArenaObj
 {
 public:
   OScPosition   scpos;
@@ -169,6 +169,41 @@ public:
   void Generate(OScope * scope) override;
 };
 
+// Loop optimization hints from the [[unroll]], [[no_unroll]], [[vectorize]], [[no_vectorize]] and
+// [[interleave]] statement attributes, emitted as llvm.loop metadata on the loop latch branch
+struct OLoopHints
+{
+  int   unroll = 0;      // -1 = disabled, 0 = no hint, 1 = enabled, > 1: unroll count
+  int   vectorize = 0;   // -1 = disabled, 0 = no hint, 1 = enabled, > 1: vector width
+  int   interleave = 0;  // 0 = no hint, otherwise the interleave count
+
+  bool Present()  { return (unroll != 0) or (vectorize != 0) or (interleave != 0); }
+
+  void ApplyAttributes(OAttr * aattr);
+  llvm::MDNode * CreateLoopMd(OScPosition & ascpos, bool amustprogress);
+};
+
+// Hinted loops of the current compilation, the optimizer reports the not honored hints by the loop metadata
+struct SLoopHintPos
+{
+  llvm::MDNode *  loop_md;
+  LlFunction *    ll_func;
+  OScPosition     scpos;
+};
+
+extern thread_local vector<SLoopHintPos>  ll_loop_hint_list;
+
+// Constant range of a for loop variable inside the loop body, the bounds checks
+// of the fixed size containers indexed by this variable are omitted when the range fits
+struct SLoopVarRange
+{
+  OValSym *  loopvar;
+  int64_t    start;  // >= 0
+  int64_t    end;    // exclusive
+};
+
+extern thread_local vector<SLoopVarRange>  ll_loopvar_ranges;
+
 class OStmtWhile : public OStmt
 {
 private:
@@ -176,6 +211,7 @@ private:
 public:
   OExpr *       condition;
   OStmtBlock *  body;
+  OLoopHints    hints;
   OStmtWhile(OScPosition & ascpos, OExpr * acondition, OScope * ascope)
   :
     super(ascpos),
@@ -192,6 +228,40 @@ public:
   void Generate(OScope * scope) override;
 };
 
+// Counted loop: "for i in <start>..<end>:", the end is exclusive and evaluated once.
+// The loop variable is read-only in the body, so its range is known for the optimizer.
+// LLVM form: guard -> preheader -> body (header) -> latch -> body / end, the latch carries the llvm.loop
+
+class OStmtFor : public OStmt
+{
+private:
+  using        super = OStmt;
+public:
+  OValSym *     loopvar;  // defined in the body scope
+  OExpr *       startexpr;
+  OExpr *       endexpr;
+  OStmtBlock *  body;
+  OLoopHints    hints;
+  OStmtFor(OScPosition & ascpos, OExpr * astart, OExpr * aend, OScope * ascope)
+  :
+    super(ascpos),
+    loopvar(nullptr),
+    startexpr(astart),
+    endexpr(aend)
+  {
+    body = new OStmtBlock(ascope, "for");
+  }
+
+  ~OStmtFor()
+  {
+    delete startexpr;
+    delete endexpr;
+    delete body;
+  }
+
+  void Generate(OScope * scope) override;
+};
+
 class OIfBranch
 {
 public:
@@ -20,7 +20,10 @@
 
 #include "expressions.h"
 #include "otype_array.h"
+#include "otype_vector.h"
 #include "otype_int.h"
+#include "otype_func.h"
+#include "consteval.h"
 #include "dqc.h"
 #include "errorcodes.h"
 
@@ -28,67 +31,70 @@ using namespace std;
 
 OType * OScope::DefineType(OType * atype)
 {
-  auto found = typesyms.find(atype->name);
-  if (found != typesyms.end())
+  OType * found = typesyms.Add(atype->nameid, atype);
+  if (found)
   {
     g_compiler->Error(DQERR_TYPE_ALREADY_DEFINED_IN, atype->name, this->debugname);
-    return found->second;
+    return found;
   }
 
-  typesyms[atype->name] = atype;
   return atype;
 }
 
 OValSym * OScope::DefineValSym(OValSym * avalsym)
 {
-  auto found = valsyms.find(avalsym->name);
-  if (found != valsyms.end())
+  OValSym * found = valsyms.Add(avalsym->nameid, avalsym);
+  if (found)
   {
     g_compiler->Error(DQERR_VS_ALREADY_DECL_SCOPE, avalsym->name, this->debugname);
-    return found->second;
+    return found;
   }
 
-  valsyms[avalsym->name] = avalsym;
   return avalsym;
 }
 
-OType * OScope::FindType(const string & name, OScope ** rscope, bool arecursive)
+OType * OScope::FindType(int32_t anameid, OScope ** rscope, bool arecursive)
 {
-  auto it = typesyms.find(name);
-  if (it != typesyms.end())
+  for (OScope * scope = this; scope; scope = scope->parent_scope)
   {
-    if (rscope)
+    OType * result = scope->typesyms.Find(anameid);
+    if (result)
     {
-      *rscope = this;
+      if (rscope)
+      {
+        *rscope = scope;
+      }
+      return result;
     }
-    return it->second;
-  }
 
-  // If not found here, check the parent scope
-  if (arecursive and (parent_scope != nullptr))
-  {
-    return parent_scope->FindType(name, rscope);
+    if (not arecursive)
+    {
+      break;
+    }
   }
 
   return nullptr;
 }
 
-OValSym * OScope::FindValSym(const string & name, OScope ** rscope, bool arecursive)
+OValSym * OScope::FindValSym(int32_t anameid, OScope ** rscope, bool arecursive)
 {
-  auto it = valsyms.find(name);
-  if (it != valsyms.end())
+  for (OScope * scope = this; scope; scope = scope->parent_scope)
   {
-    if (rscope)
+    OValSym * result = scope->valsyms.Find(anameid);
+    if (result)
     {
-      *rscope = this;
+      if (rscope)
+      {
+        *rscope = scope;
+      }
+      return result;
     }
-    return it->second;
-  }
 
-  // If not found here, check the parent scope
-  if (arecursive and vs_lookup_parent and (parent_scope != nullptr))
-  {
-    return parent_scope->FindValSym(name, rscope);
+    // If not found here, check the parent scope
+    if (not arecursive or not scope->vs_lookup_parent)
+    {
+      break;
+    }
   }
 
   return nullptr;
@@ -146,6 +152,10 @@ OType::~OType()
   {
     delete arrtype;
   }
+  for (auto & [lanes, vectype] : vector_types)
+  {
+    delete vectype;
+  }
 }
 
 OTypePointer * OType::GetPointerType()
@@ -178,12 +188,35 @@ OTypeArraySlice * OType::GetSliceType()
   return slice_type;
 }
 
+OTypeVector * OType::GetVectorType(uint32_t alanes)
+{
+  auto it = vector_types.find(alanes);
+  if (it != vector_types.end())
+  {
+    return it->second;
+  }
+  OTypeVector * result = new OTypeVector(this, alanes);
+  vector_types[alanes] = result;
+  return result;
+}
+
 OValSym * OType::CreateValSym(OScPosition & apos, const string aname)
 {
   OValSym * result = new OValSym(apos, aname, this);
   return result;
 }
 
+bool OValue::CalculateConstant(OExpr * expr, bool emit_errors)
+{
+  auto * ex = dynamic_cast<OCallExpr *>(expr);
+  if (ex and ex->vsfunc->attr_consteval)
+  {
+    return CalculateConstEvalCall(this, ex, emit_errors);
+  }
+
+  return CalculateConstantExpr(expr, emit_errors);
+}
+
 OValue * OTypePointer::CreateValue()
 {
   return new OValuePointer(this, false);
@@ -199,7 +232,7 @@ LlConst * OValuePointer::CreateLlConst()
   return llvm::ConstantPointerNull::get(llvm::PointerType::get(ll_ctx, 0));
 }
 
-bool OValuePointer::CalculateConstant(OExpr * expr, bool emit_errors)
+bool OValuePointer::CalculateConstantExpr(OExpr * expr, bool emit_errors)
 {
   is_null = false;
 
@@ -265,9 +298,10 @@ void OCompoundType::AddMember(OValSym * amember)
 
 int OCompoundType::FindMemberIndex(const string & aname)
 {
+  int32_t nameid = g_idents.Find(aname);
   for (int i = 0; i < (int)member_order.size(); ++i)
   {
-    if (member_order[i]->name == aname)  return i;
+    if (member_order[i]->nameid == nameid)  return i;
   }
   return -1;
 }
@@ -24,6 +24,8 @@
 
 #include "comp_config.h"
 #include "attributes.h"
+#include "dqc_idents.h"
+#include "dqc_arena.h"
 
 using namespace std;
 
@@ -35,17 +37,19 @@ class OScope;
 
 // Symbol and Scope
 
-class OSymbol
+class OSymbol : public OArenaObj
 {
 public:
-  string       name;
+  string       name;    // must not be changed after the construction
+  int32_t      nameid;  // interned name, the scope tables are keyed by this
   OType *      ptype;
 
   OScPosition  scpos;
 
-  OSymbol(const string aname, OType * atype = nullptr)
+  OSymbol(const string & aname, OType * atype = nullptr)
   :
     name(aname),
+    nameid(g_idents.Intern(aname)),
     ptype(atype)
   {
 
@@ -56,15 +60,15 @@ public:
   virtual ~OSymbol() = default;
 };
 
-class OScope
+class OScope : public OArenaObj
 {
 public:
   OScope *    parent_scope;
   string      debugname; // Helpful for debugging (e.g., "Class Body", "Func Body")
   bool        vs_lookup_parent = true;
 
-  map<string, OType *>    typesyms;
-  map<string, OValSym *>  valsyms;
+  OIdentMap<OType>        typesyms;
+  OIdentMap<OValSym>      valsyms;
 
   vector<OValSym *>       firstassign; // list of the variables assigned here first
 
@@ -81,8 +85,21 @@ public:
   OType *     DefineType(OType * atype);
   OValSym *   DefineValSym(OValSym * atype);
 
-  OType *     FindType(const string & name, OScope ** rscope = nullptr, bool arecursive = true);
-  OValSym *   FindValSym(const string & name, OScope ** rscope = nullptr, bool arecursive = true);
+  OType *     FindType(int32_t anameid, OScope ** rscope = nullptr, bool arecursive = true);
+  OValSym *   FindValSym(int32_t anameid, OScope ** rscope = nullptr, bool arecursive = true);
+
+  // a name which was never interned can not be defined anywhere
+  inline OType * FindType(string_view aname, OScope ** rscope = nullptr, bool arecursive = true)
+  {
+    int32_t id = g_idents.Find(aname);
+    return (id < 0 ? nullptr : FindType(id, rscope, arecursive));
+  }
+
+  inline OValSym * FindValSym(string_view aname, OScope ** rscope = nullptr, bool arecursive = true)
+  {
+    int32_t id = g_idents.Find(aname);
+    return (id < 0 ? nullptr : FindValSym(id, rscope, arecursive));
+  }
 
   LlDiScope *  GetDiScope();
 
@@ -102,6 +119,7 @@ enum ETypeKind
   TK_POINTER,
   TK_ARRAY,
   TK_ARRAY_SLICE,  // array descriptor {ptr, length} for function parameters
+  TK_VECTOR,       // SIMD vector, e.g. float32x8, the comparisons result masks like boolx8
   TK_STRING,    // ODynString, OCString
 
   TK_ALIAS,
@@ -117,6 +135,7 @@ class OTypePointer;      // forward declaration
 class OTypeFuncRef;     // forward declaration
 class OTypeArray;        // forward declaration
 class OTypeArraySlice;   // forward declaration
+class OTypeVector;       // forward declaration
 
 class OType : public OSymbol
 {
@@ -126,6 +145,7 @@ private:
   OTypePointer *     ptr_type = nullptr;    // cached pointer-to-this type
   OTypeArraySlice *  slice_type = nullptr;  // cached slice type
   map<uint32_t, OTypeArray *>  array_types; // cached fixed-size array types
+  map<uint32_t, OTypeVector *> vector_types; // cached SIMD vector types
 
 public:
   ETypeKind    kind;
@@ -169,6 +189,7 @@ public:
   OTypePointer *     GetPointerType();
   OTypeArray *       GetArrayType(uint32_t alength);
   OTypeArraySlice *  GetSliceType();
+  OTypeVector *      GetVectorType(uint32_t alanes);
   virtual OValSym *  CreateValSym(OScPosition & apos, const string aname);
   virtual OValue *   CreateValue()  { return nullptr; }
   virtual LlValue *  GenerateConversion(OScope * scope, OExpr * src)  { return nullptr; }
@@ -330,7 +351,7 @@ public:
 
   static OTypePointer * GetNullPtrType()
   {
-    static OTypePointer instance(nullptr, "null", false, true);
+    static thread_local OTypePointer instance(nullptr, "null", false, true);  // caches the LLVM type of the thread's context
     return &instance;
   }
 };
@@ -339,7 +360,7 @@ public:
 
 class OExpr;
 
-class OValue
+class OValue : public OArenaObj
 {
 public:
   OType *       ptype = nullptr;
@@ -363,7 +384,10 @@ public:
     return ll_const;
   }
 
-  virtual bool CalculateConstant(OExpr * expr, bool emit_errors = true) { return false; }
+  // dispatches the [[consteval]] calls for every value type, the rest goes to CalculateConstantExpr()
+  bool CalculateConstant(OExpr * expr, bool emit_errors = true);
+
+  virtual bool CalculateConstantExpr(OExpr * expr, bool emit_errors) { return false; }
 
   inline OType * ResolvedType() const
   {
@@ -387,12 +411,12 @@ public:
   }
 
   LlConst *  CreateLlConst() override;
-  bool       CalculateConstant(OExpr * expr, bool emit_errors = true) override;
+  bool       CalculateConstantExpr(OExpr * expr, bool emit_errors) override;
 };
 
 // Expression Base
 
-class OExpr
+class OExpr : public OArenaObj
 {
 public:
   OType *  ptype; // result type (of this node), defaults to int
@@ -427,6 +451,12 @@ public:
   {
     return (ptype ? ptype->ResolveAlias() : nullptr);
   }
+
+  inline bool IsVector() const
+  {
+    OType * rtype = ResolvedType();
+    return (rtype and (TK_VECTOR == rtype->kind));
+  }
 };
 
 // Value Symbols
@@ -465,6 +495,7 @@ public:
   EParamMode   param_mode = FPM_VALUE;
   bool         is_ref_alias = false;
   bool         ref_nullable = false;
+  bool         is_readonly = false;  // for loop variables
 
   uint32_t     attr_align = 0;
   string       attr_section_name = "";
@@ -496,7 +527,7 @@ public:
 
   inline bool IsRefWriteable() const
   {
-    return (!IsRefLike() || (FPM_REFIN != param_mode));
+    return (!is_readonly and (!IsRefLike() || (FPM_REFIN != param_mode)));
   }
 
   inline OType * GetStorageType() const
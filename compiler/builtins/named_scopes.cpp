@@ -17,7 +17,7 @@
 #include "scope_builtins.h"
 #include "scope_defines.h"
 
-map<string, OScope *> g_namespaces;
+thread_local map<string, OScope *> g_namespaces;
 
 void init_named_scopes()
 {
@@ -20,6 +20,6 @@
 
 using namespace std;
 
-extern map<string, OScope *> g_namespaces;
+extern thread_local map<string, OScope *> g_namespaces;
 
 void init_named_scopes();
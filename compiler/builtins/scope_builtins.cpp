@@ -13,7 +13,7 @@
 
 #include "scope_builtins.h"
 
-OScopeBuiltins *  g_builtins;
+thread_local OScopeBuiltins *  g_builtins;
 
 void OScopeBuiltins::Init()
 {
@@ -69,6 +69,22 @@ void OScopeBuiltins::Init()
   DefineType(type_cstring);
 
   DefineType(new OTypeAlias("byte", type_uint8));
+
+  // SIMD vectors with 128, 256 and 512 bits, like int32x4, float32x8, float64x8
+  for (OType * elemtype : {(OType *)type_int8, (OType *)type_int16, (OType *)type_int32, (OType *)type_int64,
+                           (OType *)type_uint8, (OType *)type_uint16, (OType *)type_uint32, (OType *)type_uint64,
+                           (OType *)type_float32, (OType *)type_float64})
+  {
+    for (uint32_t vbytes : {16, 32, 64})
+    {
+      uint32_t lanes = vbytes / elemtype->bytesize;
+      DefineType(elemtype->GetVectorType(lanes));
+    }
+  }
+  for (uint32_t lanes : {2, 4, 8, 16, 32, 64})
+  {
+    DefineType(type_bool->GetVectorType(lanes));  // lane masks of the comparisons
+  }
 }
 
 void init_scope_builtins()
@@ -21,6 +21,7 @@
 #include "otype_float.h"
 #include "otype_func.h"
 #include "otype_cstring.h"
+#include "otype_vector.h"
 
 class OScopeBuiltins : public OScope
 {
@@ -63,6 +64,6 @@ public:
   void Init();
 };
 
-extern OScopeBuiltins *  g_builtins;
+extern thread_local OScopeBuiltins *  g_builtins;
 
 void init_scope_builtins();
@@ -15,7 +15,7 @@
 #include "scope_defines.h"
 #include "scope_builtins.h"
 
-OScopeDefines *  g_defines;
+thread_local OScopeDefines *  g_defines;
 
 void init_scope_defines()
 {
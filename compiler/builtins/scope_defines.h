@@ -34,6 +34,6 @@ public:
 
 };
 
-extern OScopeDefines *  g_defines;
+extern thread_local OScopeDefines *  g_defines;
 
 void init_scope_defines();
\ No newline at end of file
@@ -19,16 +19,26 @@
 #include <llvm/Support/FileSystem.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/TargetParser/Host.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
 
 #include <llvm/Analysis/TargetLibraryInfo.h>
 
 #include <llvm/Passes/PassBuilder.h>
+#include <llvm/Transforms/Scalar/InductiveRangeCheckElimination.h>
+#include <llvm/Transforms/Utils/LoopSimplify.h>
 #include <llvm/IR/PassManager.h>
+#include <llvm/IR/DiagnosticHandler.h>
+#include <llvm/IR/DiagnosticInfo.h>
+#include <llvm/IR/CFG.h>
 
 #include <print>
 #include <format>
+#include <mutex>
+#include <set>
 
 #include "dqc_codegen.h"
+#include "comp_timing.h"
+#include "dqc.h"
 
 using namespace std;
 
@@ -39,8 +49,12 @@ void ODqCompCodegen::GenerateIr()
     print("Generating IR...\n");
   }
 
+  OTimeScope ts("IR generation");
+
   PrepareTarget();
 
+  ll_loop_hint_list.clear();
+
   // predeclare functions first so later global initializers can reference them
 
   for (ODecl * decl : g_module->declarations)
@@ -114,15 +128,22 @@ void ODqCompCodegen::GenerateIr()
     di_builder->finalize();
   }
 
+  ts.Stop();
+
   OptimizeIr(g_opt.optlevel);
 }
 
 void ODqCompCodegen::PrepareTarget()
 {
-  // Only initialize native target (not all targets)
-  llvm::InitializeNativeTarget();
-  llvm::InitializeNativeTargetAsmParser();
-  llvm::InitializeNativeTargetAsmPrinter();
+  // Only initialize native target (not all targets), once for all compilation threads
+  static once_flag target_init_flag;
+  call_once(target_init_flag, []()
+    {
+      llvm::InitializeNativeTarget();
+      llvm::InitializeNativeTargetAsmParser();
+      llvm::InitializeNativeTargetAsmPrinter();
+    }
+  );
 
   auto triple = llvm::sys::getDefaultTargetTriple();
   ll_module->setTargetTriple(triple);
@@ -131,20 +152,201 @@ void ODqCompCodegen::PrepareTarget()
   auto * target = llvm::TargetRegistry::lookupTarget(triple, err);
   if (!target) throw runtime_error(err);
 
-  ll_machine = target->createTargetMachine(triple, "generic", "", llvm::TargetOptions(), llvm::Reloc::PIC_);
+  ll_target_cpu = g_opt.target_cpu;
+  ll_target_features = "";
+  if ("native" == ll_target_cpu)
+  {
+    ll_target_cpu = llvm::sys::getHostCPUName().str();
+    for (auto & feat : llvm::sys::getHostCPUFeatures())
+    {
+      if (!ll_target_features.empty())  ll_target_features += ",";
+      ll_target_features += (feat.second ? "+" : "-") + feat.first().str();
+    }
+  }
+  if (!g_opt.target_features.empty())  // explicit -mattr settings come last, so they override the host ones
+  {
+    if (!ll_target_features.empty())  ll_target_features += ",";
+    ll_target_features += g_opt.target_features;
+  }
+
+  if (g_opt.verblevel >= VERBLEVEL_INFO)
+  {
+    print("Target: {}, CPU: {}\n", triple, ll_target_cpu);
+    if (!ll_target_features.empty())
+    {
+      print("Target features: {}\n", ll_target_features);
+    }
+  }
+
+  ll_machine = target->createTargetMachine(triple, ll_target_cpu, ll_target_features, ll_target_options(), llvm::Reloc::PIC_);
+  if (!ll_machine) throw runtime_error(std::format("Unable to create target machine for CPU \"{}\"", ll_target_cpu));
+
+  if ("generic" == ll_target_cpu)
+  {
+    ll_target_cpu = "";  // no function attributes for the generic target
+  }
 
   ll_module->setDataLayout(ll_machine->createDataLayout());
 
 }
 
+// Reports the loop hints that the optimizer could not honor at the source position of the loop.
+// The diagnostics refer to the loop header block, the latch branch has the loop metadata.
+// The forced vectorization reports the reason first (analysis remark), then the generic failure follows.
+struct OLoopHintDiagHandler : public llvm::DiagnosticHandler
+{
+  set<pair<OScPosition *, string>>  reported;  // one warning per position and transformation
+
+  bool handleDiagnostics(const llvm::DiagnosticInfo & adi) override
+  {
+    auto * failure = llvm::dyn_cast<llvm::DiagnosticInfoOptimizationFailure>(&adi);
+    auto * analysis = llvm::dyn_cast<llvm::OptimizationRemarkAnalysis>(&adi);
+    const llvm::DiagnosticInfoIROptimization * optdi = failure;
+    if (analysis and analysis->shouldAlwaysPrint())
+    {
+      optdi = analysis;
+    }
+    if (!optdi)
+    {
+      return false;  // the default handling
+    }
+
+    // the loop metadata might be replaced by an earlier transformation, then the function is reported
+    OScPosition * scpos = FindHintPos(optdi);
+    if (!scpos)
+    {
+      scpos = FindFuncPos(&optdi->getFunction());
+    }
+    if (!scpos)
+    {
+      return false;
+    }
+
+    string msg = optdi->getMsg();
+    string transform = msg.substr(0, msg.find(':'));  // "loop not vectorized", "loop not unrolled"
+    if (reported.insert({scpos, transform}).second)
+    {
+      g_compiler->Warning(DQWARN_LOOP_HINT_NOT_HONORED, msg, scpos);
+    }
+    return true;
+  }
+
+  OScPosition * FindHintPos(const llvm::DiagnosticInfoIROptimization * aoptdi)
+  {
+    auto * header = llvm::dyn_cast_or_null<const LlBasicBlock>(aoptdi->getCodeRegion());
+    if (!header)
+    {
+      return nullptr;
+    }
+    for (const LlBasicBlock * pred : llvm::predecessors(header))
+    {
+      llvm::MDNode * loop_md = pred->getTerminator()->getMetadata(llvm::LLVMContext::MD_loop);
+      for (SLoopHintPos & lhp : ll_loop_hint_list)
+      {
+        if (loop_md and (lhp.loop_md == loop_md))
+        {
+          return &lhp.scpos;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  // only the functions with hinted loops are reported
+  OScPosition * FindFuncPos(const LlFunction * allfunc)
+  {
+    bool hinted = false;
+    for (SLoopHintPos & lhp : ll_loop_hint_list)
+    {
+      hinted = hinted or (lhp.ll_func == allfunc);
+    }
+    if (!hinted)
+    {
+      return nullptr;
+    }
+
+    for (ODecl * decl : g_module->declarations)
+    {
+      if (DK_VALSYM != decl->kind)
+      {
+        continue;
+      }
+      if (auto * vsfunc = dynamic_cast<OValSymFunc *>(decl->pvalsym))
+      {
+        if (vsfunc->ll_func == allfunc)  return &vsfunc->scpos;
+      }
+      else if (auto * ovset = dynamic_cast<OValSymOverloadSet *>(decl->pvalsym))
+      {
+        for (OValSymFunc * fn : ovset->funcs)
+        {
+          if (fn->ll_func == allfunc)  return &fn->scpos;
+        }
+      }
+    }
+    return nullptr;
+  }
+};
+
+bool ODqCompCodegen::HasAlwaysInline()
+{
+  for (LlFunction & f : *ll_module)
+  {
+    if (f.hasFnAttribute(llvm::Attribute::AlwaysInline))
+    {
+      return true;
+    }
+    for (llvm::User * user : f.users())
+    {
+      auto * ll_call = llvm::dyn_cast<llvm::CallBase>(user);
+      if (ll_call and ll_call->hasFnAttr(llvm::Attribute::AlwaysInline))
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 void ODqCompCodegen::OptimizeIr(int aoptlevel)
 {
-  if (0 == aoptlevel)
+  if ((0 == aoptlevel) and !HasAlwaysInline())
   {
     return;
   }
 
-  llvm::PassBuilder PB;
+  OTimeScope ts("IR optimization");
+
+  if (!ll_loop_hint_list.empty())
+  {
+    ll_ctx.setDiagnosticHandler(make_unique<OLoopHintDiagHandler>());
+  }
+
+  // pass timings for the -ftime-report / -ftime-trace
+  llvm::PassInstrumentationCallbacks PIC;
+  if (g_timer.Enabled())
+  {
+    PIC.registerBeforeNonSkippedPassCallback(
+      [](llvm::StringRef apass, llvm::Any)
+      {
+        g_timer.PassBegin(apass.str());
+      }
+    );
+    PIC.registerAfterPassCallback(
+      [](llvm::StringRef apass, llvm::Any, const llvm::PreservedAnalyses &)
+      {
+        g_timer.PassEnd(apass.str());
+      }
+    );
+    PIC.registerAfterPassInvalidatedCallback(
+      [](llvm::StringRef apass, const llvm::PreservedAnalyses &)
+      {
+        g_timer.PassEnd(apass.str());
+      }
+    );
+  }
+
+  // the target machine provides the cost model (vector widths etc.) for the optimizer
+  llvm::PassBuilder PB(ll_machine, llvm::PipelineTuningOptions(), {}, &PIC);
 
   llvm::LoopAnalysisManager     LAM;
   llvm::FunctionAnalysisManager FAM;
@@ -159,7 +361,14 @@ void ODqCompCodegen::OptimizeIr(int aoptlevel)
 
   llvm::OptimizationLevel ll_optlevel;
 
-  if (2 == aoptlevel)
+  if (0 == aoptlevel)
+  {
+    // only the [[inline]] / [[flatten]] inlining
+    llvm::ModulePassManager MPM = PB.buildO0DefaultPipeline(llvm::OptimizationLevel::O0);
+    MPM.run(*ll_module, MAM);
+    return;
+  }
+  else if (2 == aoptlevel)
   {
     ll_optlevel = llvm::OptimizationLevel::O2;
   }
@@ -172,12 +381,47 @@ void ODqCompCodegen::OptimizeIr(int aoptlevel)
     ll_optlevel = llvm::OptimizationLevel::O1;
   }
 
-  llvm::ModulePassManager MPM = PB.buildPerModuleDefaultPipeline(ll_optlevel);
+  if (g_opt.bounds_check)
+  {
+    // -fbounds-check: the inductive range check elimination splits the loops into a checked
+    // pre/post loop and an unchecked main loop, so the checks are hoisted out of the while loops too
+    // (the LTO link pipeline registers it too, see dqc_link_lto.cpp)
+    PB.registerScalarOptimizerLateEPCallback(
+      [](llvm::FunctionPassManager & FPM, llvm::OptimizationLevel alevel)
+      {
+        FPM.addPass(llvm::LoopSimplifyPass());
+        FPM.addPass(llvm::IRCEPass());
+      }
+    );
+  }
+
+  llvm::ModulePassManager MPM;
+  if (g_opt.lto and !g_opt.jit_run)
+  {
+    // the inlining and the whole program optimizations are left for the link time
+    MPM = PB.buildLTOPreLinkDefaultPipeline(ll_optlevel);
+  }
+  else
+  {
+    MPM = PB.buildPerModuleDefaultPipeline(ll_optlevel);
+  }
   MPM.run(*ll_module, MAM);
 }
 
 void ODqCompCodegen::EmitObject(const string afilename)
 {
+  if (g_opt.lto)
+  {
+    EmitBitcode(afilename);
+    return;
+  }
+
+  if (g_opt.codegen_threads > 1)
+  {
+    EmitObjectParallel(afilename, g_opt.codegen_threads);
+    return;
+  }
+
   if (g_opt.verblevel >= VERBLEVEL_STATUS)
   {
     print("Writing object file \"{}\"...\n", afilename);
@@ -188,14 +432,35 @@ void ODqCompCodegen::EmitObject(const string afilename)
   if (ec) throw runtime_error(ec.message());
 
   llvm::legacy::PassManager pm;
-  ll_machine->addPassesToEmitFile(pm, out, nullptr, llvm::CodeGenFileType::ObjectFile);
+  if (ll_machine->addPassesToEmitFile(pm, out, nullptr, llvm::CodeGenFileType::ObjectFile))
+  {
+    throw runtime_error("The target can not emit object files");
+  }
   pm.run(*ll_module);
   out.flush();
 }
 
+void ODqCompCodegen::EmitBitcode(const string afilename)
+{
+  if (g_opt.verblevel >= VERBLEVEL_STATUS)
+  {
+    print("Writing bitcode object file \"{}\"...\n", afilename);
+  }
+
+  error_code ec;
+  llvm::raw_fd_ostream out(afilename, ec, llvm::sys::fs::OF_None);
+  if (ec) throw runtime_error(ec.message());
+
+  llvm::WriteBitcodeToFile(*ll_module, out);
+  out.flush();
+}
+
 void ODqCompCodegen::PrintIr()
 {
+  // the stdio and the llvm::outs() have separate buffers, flush them to keep the order
   print("=== LLVM IR ===\n");
+  fflush(stdout);
   ll_module->print(llvm::outs(), nullptr);
+  llvm::outs().flush();
   print("===============\n\n");
 }
@@ -45,8 +45,13 @@ public:
   void PrepareTarget();
   void GenerateIr();
   void OptimizeIr(int aoptlevel);
+  bool HasAlwaysInline();  // [[inline]] functions or [[flatten]] call sites, inlined also at -O0
   void PrintIr();
 
   void EmitObject(const string afilename);
+  void EmitObjectParallel(const string afilename, int athreads);  // dqc_codegen_split.cpp
+  void EmitBitcode(const string afilename);  // -flto: the code generation happens at link time
+
+  int  JitRunMain(const vector<string> & aargs, bool aintresult);  // dqc_jit.cpp
 
 };
\ No newline at end of file
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    dqc_codegen_split.cpp
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   multi-threaded object emission by splitting the module into partitions
+ */
+
+// these include also provide llvm::format() so the std::format() must be fully specified
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Target/TargetOptions.h>
+#include <llvm/MC/TargetRegistry.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Transforms/Utils/SplitModule.h>
+#include <llvm/Transforms/Utils/ModuleUtils.h>
+
+#include <print>
+#include <format>
+#include <thread>
+#include <filesystem>
+
+#include "dqc_codegen.h"
+#include "dqc_link.h"
+
+using namespace std;
+
+// The partitions are cloned into the context of the ll_module, which can not be shared between
+// threads. So every partition is serialized to bitcode and loaded into a thread-own context.
+
+static string EmitPartition(const llvm::SmallString<0> & abitcode, const string & atriple, const string & acpu,
+                            const string & afeatures, const llvm::TargetOptions & aoptions, const string & afilename)
+{
+  LlContext ctx;
+  auto mod_exp = llvm::parseBitcodeFile(llvm::MemoryBufferRef(abitcode.str(), afilename), ctx);
+  if (!mod_exp)
+  {
+    return "bitcode read error: " + llvm::toString(mod_exp.takeError());
+  }
+  unique_ptr<LlModule> mod = std::move(*mod_exp);
+
+  string err;
+  auto * target = llvm::TargetRegistry::lookupTarget(atriple, err);
+  if (!target)
+  {
+    return err;
+  }
+
+  unique_ptr<LlMachine> machine(target->createTargetMachine(atriple, acpu, afeatures, aoptions, llvm::Reloc::PIC_));
+  if (!machine)
+  {
+    return std::format("unable to create target machine for CPU \"{}\"", acpu);
+  }
+
+  error_code ec;
+  llvm::raw_fd_ostream out(afilename, ec, llvm::sys::fs::OF_None);
+  if (ec)
+  {
+    return ec.message();
+  }
+
+  llvm::legacy::PassManager pm;
+  if (machine->addPassesToEmitFile(pm, out, nullptr, llvm::CodeGenFileType::ObjectFile))
+  {
+    return "the target can not emit object files";
+  }
+  pm.run(*mod);
+  out.flush();
+  return "";
+}
+
+void ODqCompCodegen::EmitObjectParallel(const string afilename, int athreads)
+{
+  if (g_opt.verblevel >= VERBLEVEL_STATUS)
+  {
+    print("Writing object file \"{}\" with {} code generator threads...\n", afilename, athreads);
+  }
+
+  // llvm::SplitModule() promotes the local symbols to hidden globals keeping their names
+  // (".str", "__dq_bounds_error"), which would collide with the same symbols of the other units
+  // at the final link. So the local symbols get a module unique suffix before the split.
+  string modid = llvm::getUniqueModuleId(ll_module);  // hash of the exported symbol names
+  if (modid.empty())
+  {
+    modid = std::format(".{:x}", hash<string>{}(afilename));
+  }
+  for (llvm::GlobalValue & gv : ll_module->global_values())
+  {
+    if (gv.hasLocalLinkage())
+    {
+      gv.setName((gv.hasName() ? gv.getName().str() : string("__dq_local")) + modid);
+    }
+  }
+
+  // split by function
+  vector<llvm::SmallString<0>> partitions;
+  llvm::SplitModule(*ll_module, athreads,
+    [&partitions](unique_ptr<LlModule> apart)
+    {
+      llvm::SmallString<0> & bc = partitions.emplace_back();
+      llvm::raw_svector_ostream bcout(bc);
+      llvm::WriteBitcodeToFile(*apart, bcout);
+    }
+  );
+
+  string triple   = ll_module->getTargetTriple();
+  string cpu      = ll_machine->getTargetCPU().str();
+  string features = ll_machine->getTargetFeatureString().str();
+  llvm::TargetOptions ll_machine_options = ll_machine->Options;
+
+  vector<string>  partfiles(partitions.size());
+  vector<string>  errors(partitions.size());
+  vector<thread>  threads;
+  for (size_t i = 0; i < partitions.size(); ++i)
+  {
+    partfiles[i] = std::format("{}.part{}.o", afilename, i);
+    threads.emplace_back(
+      [&, i]()
+      {
+        errors[i] = EmitPartition(partitions[i], triple, cpu, features, ll_machine_options, partfiles[i]);
+      }
+    );
+  }
+  for (thread & t : threads)
+  {
+    t.join();
+  }
+
+  auto remove_partfiles = [&partfiles]()
+  {
+    for (const string & fn : partfiles)
+    {
+      error_code ec;
+      filesystem::remove(fn, ec);
+    }
+  };
+
+  for (size_t i = 0; i < errors.size(); ++i)
+  {
+    if (!errors[i].empty())
+    {
+      remove_partfiles();
+      throw runtime_error(std::format("Code generation error in partition {}: {}", i, errors[i]));
+    }
+  }
+
+  // combine the partitions into the requested object file
+  OLinkDriver linker;
+  linker.SetLinker(g_opt.linker);
+  if (!linker.LinkRelocatable(partfiles, afilename))
+  {
+    ++errorcnt;
+    print("Error combining the code generator partitions.\n");
+  }
+
+  remove_partfiles();
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    dqc_jit.cpp
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   in-process execution of the generated module with the LLVM ORC JIT
+ */
+
+// these include also provide llvm::format() so the std::format() must be fully specified
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/TargetProcess/TargetExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+
+#include <print>
+#include <format>
+
+#include "dqc_codegen.h"
+
+using namespace std;
+
+// the link driver adds the libm and the libc itself, the others are merged into the libc since glibc 2.34
+static bool IsHostRuntimeLib(const string & alibname)
+{
+  return ("m" == alibname) or ("c" == alibname) or ("pthread" == alibname) or ("dl" == alibname)
+         or ("rt" == alibname);
+}
+
+int ODqCompCodegen::JitRunMain(const vector<string> & aargs, bool aintresult)
+{
+  if (g_opt.verblevel >= VERBLEVEL_STATUS)
+  {
+    print("Running main() with JIT...\n");
+  }
+
+  auto jit_exp = llvm::orc::LLJITBuilder().create();
+  if (!jit_exp)
+  {
+    throw runtime_error("JIT init error: " + llvm::toString(jit_exp.takeError()));
+  }
+
+  unique_ptr<llvm::orc::LLJIT> jit = std::move(*jit_exp);
+
+  // external C functions (printf, strnlen, ...) are resolved from the host process
+  auto gen_exp = llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+      jit->getDataLayout().getGlobalPrefix());
+  if (!gen_exp)
+  {
+    throw runtime_error("JIT symbol generator error: " + llvm::toString(gen_exp.takeError()));
+  }
+  jit->getMainJITDylib().addGenerator(std::move(*gen_exp));
+
+  // the #linklib libraries, the linker would get them with -l<name>
+  for (const string & libname : g_opt.link_libraries)
+  {
+    if (IsHostRuntimeLib(libname))
+    {
+      continue;  // already in the host process
+    }
+
+    string libfile = std::format("lib{}.so", libname);
+    auto libgen_exp = llvm::orc::DynamicLibrarySearchGenerator::Load(
+        libfile.c_str(), jit->getDataLayout().getGlobalPrefix());
+    if (!libgen_exp)
+    {
+      print("Unable to load the library \"{}\" for the JIT: {}\n", libfile, llvm::toString(libgen_exp.takeError()));
+      ++errorcnt;
+      return 1;
+    }
+    jit->getMainJITDylib().addGenerator(std::move(*libgen_exp));
+  }
+
+  // The module is moved into a context owned by the JIT through bitcode, the thread local
+  // ll_ctx and the ll_module remain with the compiler.
+  llvm::SmallVector<char, 0> bcbuf;
+  llvm::raw_svector_ostream  bcstream(bcbuf);
+  llvm::WriteBitcodeToFile(*ll_module, bcstream);
+
+  auto jit_ctx = make_unique<LlContext>();
+  auto mod_exp = llvm::parseBitcodeFile(
+      llvm::MemoryBufferRef(llvm::StringRef(bcbuf.data(), bcbuf.size()), ll_module->getName()), *jit_ctx);
+  if (!mod_exp)
+  {
+    throw runtime_error("JIT module error: " + llvm::toString(mod_exp.takeError()));
+  }
+
+  llvm::orc::ThreadSafeModule tsm{std::move(*mod_exp), llvm::orc::ThreadSafeContext(std::move(jit_ctx))};
+  if (auto err = jit->addIRModule(std::move(tsm)))
+  {
+    throw runtime_error("JIT module error: " + llvm::toString(std::move(err)));
+  }
+
+  auto sym_exp = jit->lookup("main");
+  if (!sym_exp)
+  {
+    throw runtime_error("JIT main() lookup error: " + llvm::toString(sym_exp.takeError()));
+  }
+
+  if (!aintresult)
+  {
+    sym_exp->toPtr<void (*)()>()();
+    return 0;
+  }
+
+  // argv[0] is the first element of aargs
+  vector<string> prgargs(aargs.begin() + (aargs.empty() ? 0 : 1), aargs.end());
+  return llvm::orc::runAsMain(sym_exp->toPtr<int (*)(int, char **)>(), prgargs,
+                              aargs.empty() ? llvm::StringRef("dq") : llvm::StringRef(aargs[0]));
+}
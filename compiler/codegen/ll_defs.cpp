@@ -11,20 +11,30 @@
  * brief:   LLVM defines, object
  */
 
+#include <format>
+#include <stdexcept>
+
 #include "ll_defs.h"
 #include "dqc.h"
 #include "scf_dq.h"
 #include "comp_options.h"
 
-LlContext      ll_ctx;
-LlBuilder      ll_builder(ll_ctx);
-LlModule *     ll_module;
+thread_local LlContext      ll_ctx;
+thread_local LlBuilder      ll_builder(ll_ctx);
+thread_local LlModule *     ll_module;
+
+thread_local string         ll_target_cpu;
+thread_local string         ll_target_features;
 
-vector<SLoopContext>   ll_loop_stack;
+thread_local vector<SLoopContext>   ll_loop_stack;
 
-LlDiBuilder *          di_builder = nullptr;
-LlDiUnit *             di_unit = nullptr;
-LlDiFile *             di_main_file = nullptr;
+thread_local llvm::Instruction *    ll_alloca_point = nullptr;
+thread_local int                    ll_int_overflow = INTOVF_WRAP;
+thread_local bool                   ll_bounds_check = false;
+
+thread_local LlDiBuilder *          di_builder = nullptr;
+thread_local LlDiUnit *             di_unit = nullptr;
+thread_local LlDiFile *             di_main_file = nullptr;
 
 void ll_defs_init()
 {
@@ -32,6 +42,54 @@ void ll_defs_init()
   di_builder = new LlDiBuilder(*ll_module);
 }
 
+LlValue * ll_create_alloca(LlType * atype, const string & aname)
+{
+  if (!ll_alloca_point)
+  {
+    throw logic_error(std::format("ll_create_alloca(\"{}\"): no function context", aname));
+  }
+
+  llvm::IRBuilder<> entry_builder(ll_alloca_point);
+  return entry_builder.CreateAlloca(atype, nullptr, aname);
+}
+
+llvm::MDNode * ll_loop_metadata(const vector<llvm::Metadata *> & aprops, bool amustprogress)
+{
+  vector<llvm::Metadata *> mds;
+  mds.push_back(nullptr);  // placeholder for the self reference
+  if (amustprogress)
+  {
+    mds.push_back(llvm::MDNode::get(ll_ctx, llvm::MDString::get(ll_ctx, "llvm.loop.mustprogress")));
+  }
+  mds.insert(mds.end(), aprops.begin(), aprops.end());
+
+  llvm::MDNode * result = llvm::MDNode::getDistinct(ll_ctx, mds);
+  result->replaceOperandWith(0, result);
+  return result;
+}
+
+llvm::TargetOptions ll_target_options()
+{
+  llvm::TargetOptions result;
+  if (g_opt.fast_math)
+  {
+    result.UnsafeFPMath = true;
+    result.NoNaNsFPMath = true;
+    result.NoInfsFPMath = true;
+    result.NoSignedZerosFPMath = true;
+  }
+
+  if (g_opt.fast_math or (FPCONTRACT_FAST == g_opt.fp_contract))
+  {
+    result.AllowFPOpFusion = llvm::FPOpFusion::Fast;
+  }
+  else if (FPCONTRACT_OFF == g_opt.fp_contract)
+  {
+    result.AllowFPOpFusion = llvm::FPOpFusion::Strict;
+  }
+  return result;
+}
+
 void ll_init_debug_info()
 {
   if (not g_opt.dbg_info)
@@ -48,22 +48,41 @@ using LlDiType       = llvm::DIType;
 
 // global variables
 
-extern LlContext     ll_ctx;
-extern LlBuilder     ll_builder;
-extern LlModule *    ll_module;
+// every compilation thread has its own LLVM context and module
+extern thread_local LlContext     ll_ctx;
+extern thread_local LlBuilder     ll_builder;
+extern thread_local LlModule *    ll_module;
 
-extern LlDiBuilder * di_builder;
-extern LlDiUnit *    di_unit;
-extern LlDiFile *    di_main_file;
+extern thread_local string        ll_target_cpu;       // resolved target CPU, empty = generic
+extern thread_local string        ll_target_features;  // resolved target feature string
+
+extern thread_local LlDiBuilder * di_builder;
+extern thread_local LlDiUnit *    di_unit;
+extern thread_local LlDiFile *    di_main_file;
 
 // Loop context for break/continue
 struct SLoopContext
 {
   LlBasicBlock *  cond_bb;  // continue target
   LlBasicBlock *  end_bb;   // break target
+  llvm::MDNode *  loop_md = nullptr;  // when the continue branch is a backedge (while)
 };
 
-extern vector<SLoopContext>  ll_loop_stack;
+extern thread_local vector<SLoopContext>  ll_loop_stack;
+
+// distinct self referencing llvm.loop node for the latch branch, optionally with llvm.loop.mustprogress
+llvm::MDNode * ll_loop_metadata(const vector<llvm::Metadata *> & aprops = {}, bool amustprogress = true);
+
+// All local allocas of the current function are placed before this marker in the entry block,
+// so they are static (no stack growth in loops) and the mem2reg / SROA can promote them
+extern thread_local llvm::Instruction *   ll_alloca_point;
+
+LlValue * ll_create_alloca(LlType * atype, const string & aname);
+
+extern thread_local int  ll_int_overflow;  // integer overflow model of the current function (EIntOverflow)
+extern thread_local bool ll_bounds_check;  // index bounds checking in the current function
+
+llvm::TargetOptions ll_target_options();  // floating point model from the command line options
 
 extern vector<LlDiScope *>   di_scope_stack;
 
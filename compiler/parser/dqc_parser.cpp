@@ -14,16 +14,19 @@
 #include <print>
 #include <format>
 #include <ranges>
+#include <algorithm>
 
 #include "dq_module.h"
 #include "dqc_parser.h"
 #include "otype_func.h"
 #include "otype_array.h"
 #include "otype_cstring.h"
+#include "otype_vector.h"
 #include "named_scopes.h"
 #include "scope_defines.h"
 #include "expressions.h"
 #include "statements.h"
+#include "dqc_keywords.h"
 
 using namespace std;
 
@@ -51,33 +54,16 @@ static bool SupportsFuncParamDefaultType(OType * ptype)
   return false;
 }
 
-static bool ParseParamModeKeyword(const string & sid, EParamMode & rmode)
+static bool ParseParamModeKeyword(EKeyword akw, EParamMode & rmode)
 {
-  if ("ref" == sid)
+  switch (akw)
   {
-    rmode = FPM_REF;
-    return true;
-  }
-
-  if ("refin" == sid)
-  {
-    rmode = FPM_REFIN;
-    return true;
-  }
-
-  if ("refout" == sid)
-  {
-    rmode = FPM_REFOUT;
-    return true;
-  }
-
-  if ("refnull" == sid)
-  {
-    rmode = FPM_REFNULL;
-    return true;
+    case KW_REF:      rmode = FPM_REF;      return true;
+    case KW_REFIN:    rmode = FPM_REFIN;    return true;
+    case KW_REFOUT:   rmode = FPM_REFOUT;   return true;
+    case KW_REFNULL:  rmode = FPM_REFNULL;  return true;
+    default:          return false;
   }
-
-  return false;
 }
 
 ODqCompParser::ODqCompParser()
@@ -93,21 +79,21 @@ ODqCompParser::~ODqCompParser()
 void ODqCompParser::RecoverFailedFunctionDecl()
 {
   scf->SkipWhite();
-  if (scf->CheckSymbol(";"))
+  if (scf->CheckTokSymbol(";"))
   {
     return;
   }
 
-  if (scf->CheckSymbol(":", false))
+  if (scf->CheckTokSymbol(":", false))
   {
-    scf->CheckSymbol(":");
+    scf->CheckTokSymbol(":");
     scf->SearchPattern("endfunc", true);
     return;
   }
 
-  if (scf->CheckSymbol("{", false))
+  if (scf->CheckTokSymbol("{", false))
   {
-    scf->CheckSymbol("{");
+    scf->CheckTokSymbol("{");
     scf->SearchPattern("}", true);
     return;
   }
@@ -115,16 +101,26 @@ void ODqCompParser::RecoverFailedFunctionDecl()
   SkipToModuleStatementStart();
 }
 
-bool ODqCompParser::ParseAttrIntArg(const string & attrname, int64_t & rvalue, bool positive_only)
+bool ODqCompParser::ParseAttrIntArg(const string & attrname, int64_t & rvalue, bool positive_only, const char * akeyname)
 {
   scf->SkipWhite();
-  if (!scf->CheckSymbol("("))
+  if (!scf->CheckTokSymbol("("))
   {
     Error(DQERR_MISSING_OPEN_PAREN_AFTER, attrname);
     return false;
   }
 
   scf->SkipWhite();
+  if (akeyname and scf->CheckTokIdentifier(g_idents.Intern(akeyname)))  // optional "<key>=" before the value
+  {
+    scf->SkipWhite();
+    if (!scf->CheckTokSymbol("="))
+    {
+      Error(DQERR_ATTR_ARG_INT, attrname);
+      return false;
+    }
+    scf->SkipWhite();
+  }
   if (!scf->ReadInt64Value(rvalue))
   {
     Error(DQERR_ATTR_ARG_INT, attrname);
@@ -138,7 +134,7 @@ bool ODqCompParser::ParseAttrIntArg(const string & attrname, int64_t & rvalue, b
   }
 
   scf->SkipWhite();
-  if (!scf->CheckSymbol(")"))
+  if (!scf->CheckTokSymbol(")"))
   {
     Error(DQERR_MISSING_CLOSE_PAREN_AFTER, attrname);
     return false;
@@ -150,7 +146,7 @@ bool ODqCompParser::ParseAttrIntArg(const string & attrname, int64_t & rvalue, b
 bool ODqCompParser::ParseAttrStringArg(const string & attrname, string & rvalue)
 {
   scf->SkipWhite();
-  if (!scf->CheckSymbol("("))
+  if (!scf->CheckTokSymbol("("))
   {
     Error(DQERR_MISSING_OPEN_PAREN_AFTER, attrname);
     return false;
@@ -164,7 +160,46 @@ bool ODqCompParser::ParseAttrStringArg(const string & attrname, string & rvalue)
   }
 
   scf->SkipWhite();
-  if (!scf->CheckSymbol(")"))
+  if (!scf->CheckTokSymbol(")"))
+  {
+    Error(DQERR_MISSING_CLOSE_PAREN_AFTER, attrname);
+    return false;
+  }
+
+  return true;
+}
+
+bool ODqCompParser::ParseAttrIdArg(const string & attrname, const vector<string> & aallowed, int & ridx)
+{
+  string allowed_list;
+  for (const string & s : aallowed)
+  {
+    allowed_list += (allowed_list.empty() ? "" : ", ") + s;
+  }
+
+  scf->SkipWhite();
+  if (!scf->CheckTokSymbol("("))
+  {
+    Error(DQERR_MISSING_OPEN_PAREN_AFTER, attrname);
+    return false;
+  }
+
+  scf->SkipWhite();
+  string sid;
+  auto it = aallowed.end();
+  if (scf->ReadIdentifier(sid))
+  {
+    it = find(aallowed.begin(), aallowed.end(), sid);
+  }
+  if (it == aallowed.end())
+  {
+    Error(DQERR_ATTR_ARG_ID, attrname, allowed_list);
+    return false;
+  }
+  ridx = int(it - aallowed.begin());
+
+  scf->SkipWhite();
+  if (!scf->CheckTokSymbol(")"))
   {
     Error(DQERR_MISSING_CLOSE_PAREN_AFTER, attrname);
     return false;
@@ -181,7 +216,7 @@ bool ODqCompParser::ParseSingleAttribute(const string & attrname)
   {
     attr->SetFlag(ATTF_EXTERNAL);
     attr->external_linkage_name = "";
-    if (scf->CheckSymbol("(", false))
+    if (scf->CheckTokSymbol("(", false))
     {
       if (!ParseAttrStringArg(attrname, attr->external_linkage_name))
       {
@@ -205,7 +240,7 @@ bool ODqCompParser::ParseSingleAttribute(const string & attrname)
 
   if ("overload" == attrname)
   {
-    if (scf->CheckSymbol("(", false))
+    if (scf->CheckTokSymbol("(", false))
     {
       Error(DQERR_ATTR_PAREN_NOT_ALLOWED, attrname);
       return false;
@@ -216,7 +251,7 @@ bool ODqCompParser::ParseSingleAttribute(const string & attrname)
 
   if ("override" == attrname)
   {
-    if (scf->CheckSymbol("(", false))
+    if (scf->CheckTokSymbol("(", false))
     {
       Error(DQERR_ATTR_PAREN_NOT_ALLOWED, attrname);
       return false;
@@ -227,7 +262,7 @@ bool ODqCompParser::ParseSingleAttribute(const string & attrname)
 
   if ("virtual" == attrname)
   {
-    if (scf->CheckSymbol("(", false))
+    if (scf->CheckTokSymbol("(", false))
     {
       Error(DQERR_ATTR_PAREN_NOT_ALLOWED, attrname);
       return false;
@@ -238,7 +273,7 @@ bool ODqCompParser::ParseSingleAttribute(const string & attrname)
 
   if ("volatile" == attrname)
   {
-    if (scf->CheckSymbol("(", false))
+    if (scf->CheckTokSymbol("(", false))
     {
       Error(DQERR_ATTR_PAREN_NOT_ALLOWED, attrname);
       return false;
@@ -247,6 +282,118 @@ bool ODqCompParser::ParseSingleAttribute(const string & attrname)
     return true;
   }
 
+  static const vector<pair<string, EAttrFlag>>  func_hint_attrs = {
+    {"inline",   ATTF_INLINE},
+    {"noinline", ATTF_NOINLINE},
+    {"flatten",  ATTF_FLATTEN},
+    {"hot",      ATTF_HOT},
+    {"cold",     ATTF_COLD},
+    {"pure",     ATTF_PURE},
+    {"readnone", ATTF_READNONE}
+  };
+  for (auto & fha : func_hint_attrs)
+  {
+    if (fha.first == attrname)
+    {
+      if (scf->CheckTokSymbol("(", false))
+      {
+        Error(DQERR_ATTR_PAREN_NOT_ALLOWED, attrname);
+        return false;
+      }
+      attr->SetFlag(fha.second);
+      return true;
+    }
+  }
+
+  if ("fastmath" == attrname)
+  {
+    if (scf->CheckTokSymbol("(", false))
+    {
+      Error(DQERR_ATTR_PAREN_NOT_ALLOWED, attrname);
+      return false;
+    }
+    attr->SetFlag(ATTF_FASTMATH);
+    return true;
+  }
+
+  if ("consteval" == attrname)
+  {
+    if (scf->CheckTokSymbol("(", false))
+    {
+      Error(DQERR_ATTR_PAREN_NOT_ALLOWED, attrname);
+      return false;
+    }
+    attr->SetFlag(ATTF_CONSTEVAL);
+    return true;
+  }
+
+  if ("overflow" == attrname)
+  {
+    attr->SetFlag(ATTF_OVERFLOW);
+    return ParseAttrIdArg(attrname, {"wrap", "nsw", "trap"}, attr->overflow_mode);  // EIntOverflow order
+  }
+
+  if ("bounds_check" == attrname)  // [[bounds_check]] or [[bounds_check(on|off)]]
+  {
+    attr->SetFlag(ATTF_BOUNDS_CHECK);
+    attr->bounds_check_mode = 0;
+    if (scf->CheckTokSymbol("(", false))
+    {
+      return ParseAttrIdArg(attrname, {"on", "off"}, attr->bounds_check_mode);
+    }
+    return true;
+  }
+
+  if ("unroll" == attrname)  // [[unroll]] or [[unroll(<count>)]]
+  {
+    attr->SetFlag(ATTF_UNROLL);
+    attr->unroll_count = 0;
+    if (scf->CheckTokSymbol("(", false))
+    {
+      return ParseAttrIntArg(attrname, attr->unroll_count, true);
+    }
+    return true;
+  }
+
+  if ("no_unroll" == attrname)
+  {
+    if (scf->CheckTokSymbol("(", false))
+    {
+      Error(DQERR_ATTR_PAREN_NOT_ALLOWED, attrname);
+      return false;
+    }
+    attr->SetFlag(ATTF_NO_UNROLL);
+    return true;
+  }
+
+  if ("vectorize" == attrname)  // [[vectorize]], [[vectorize(<width>)]] or [[vectorize(width=<width>)]]
+  {
+    attr->SetFlag(ATTF_VECTORIZE);
+    attr->vectorize_width = 0;
+    if (scf->CheckTokSymbol("(", false))
+    {
+      return ParseAttrIntArg(attrname, attr->vectorize_width, true, "width");
+    }
+    return true;
+  }
+
+  if ("no_vectorize" == attrname)
+  {
+    if (scf->CheckTokSymbol("(", false))
+    {
+      Error(DQERR_ATTR_PAREN_NOT_ALLOWED, attrname);
+      return false;
+    }
+    attr->SetFlag(ATTF_NO_VECTORIZE);
+    return true;
+  }
+
+  if ("interleave" == attrname)
+  {
+    attr->SetFlag(ATTF_INTERLEAVE);
+    return ParseAttrIntArg(attrname, attr->interleave_count, true);
+  }
+
   Error(DQERR_ATTR_UNKNOWN, attrname);
   return false;
 }
@@ -256,7 +403,7 @@ bool ODqCompParser::ParseAttributeBlock()
   OScPosition attrpos;
 
   scf->SaveCurPos(attrpos);
-  if (!scf->CheckSymbol("[["))
+  if (!scf->CheckTokSymbol("[["))
   {
     return true;
   }
@@ -282,12 +429,12 @@ bool ODqCompParser::ParseAttributeBlock()
     }
 
     scf->SkipWhite();
-    if (scf->CheckSymbol("]]"))
+    if (scf->CheckTokSymbol("]]"))
     {
       return true;
     }
 
-    if (!scf->CheckSymbol(","))
+    if (!scf->CheckTokSymbol(","))
     {
       Error(DQERR_ATTR_SEPARATOR);
       SkipToSymbol("]]");
@@ -309,7 +456,7 @@ bool ODqCompParser::ParseAttributes(bool areset)
   while (!scf->Eof())
   {
     scf->SkipWhite();
-    if (!scf->CheckSymbol("[[", false))
+    if (!scf->CheckTokSymbol("[[", false))
     {
       break;
     }
@@ -357,35 +504,37 @@ void ODqCompParser::ParseModule()
     // The module root statement must start with a keyword like
     //   use, module, var, type, function, implementation
 
-    if ("var" == sid) // global variable definition
-    {
-      ParseStmtVar(true);
-    }
-    else if ("const" == sid) // global constant definition
-    {
-      ParseStmtConst(true);
-    }
-    else if ("type" == sid)
-    {
-      ParseRootTypeDecl();
-    }
-    else if ("function" == sid)
-    {
-      ParseFunction();
-      curscope = cur_mod_scope;
-      curblock = nullptr;
-    }
-    else if ("struct" == sid)
-    {
-      ParseStructDecl();
-    }
-    else if ("object" == sid)
-    {
-      ParseObjectDecl();
-    }
-    else  // unknown
+    switch (KeywordOfId(scf->previdentid))  // interned by the ReadIdentifier()
     {
-      RootStatementError(DQERR_MODULE_STATEMENT_UNKNOWN, sid, &scpos_statement_start);
+      case KW_VAR:  // global variable definition
+        ParseStmtVar(true);
+        break;
+
+      case KW_CONST:  // global constant definition
+        ParseStmtConst(true);
+        break;
+
+      case KW_TYPE:
+        ParseRootTypeDecl();
+        break;
+
+      case KW_FUNCTION:
+        ParseFunction();
+        curscope = cur_mod_scope;
+        curblock = nullptr;
+        break;
+
+      case KW_STRUCT:
+        ParseStructDecl();
+        break;
+
+      case KW_OBJECT:
+        ParseObjectDecl();
+        break;
+
+      default:  // unknown
+        RootStatementError(DQERR_MODULE_STATEMENT_UNKNOWN, sid, &scpos_statement_start);
+        break;
     }
   }
 
@@ -414,7 +563,7 @@ void ODqCompParser::ParseStmtVar(bool arootstmt)
     return;
   }
 
-  pvalsym = curscope->FindValSym(sid, nullptr, false);  // do not search in the parent scopes this time !
+  pvalsym = curscope->FindValSym(scf->previdentid, nullptr, false);  // do not search in the parent scopes this time !
   if (pvalsym)
   {
     StatementError(DQERR_VS_ALREADY_DECL_TYPE, sid, pvalsym->ptype->name, &scf->prevpos);
@@ -422,7 +571,7 @@ void ODqCompParser::ParseStmtVar(bool arootstmt)
   }
 
   scf->SkipWhite();
-  if (not scf->CheckSymbol(":"))
+  if (not scf->CheckTokSymbol(":"))
   {
     StatementError(DQERR_TYPE_SPECIFIER_EXP_AFTER, sid);
     return;
@@ -438,14 +587,14 @@ void ODqCompParser::ParseStmtVar(bool arootstmt)
   OExpr * initexpr = nullptr;
   bool zero_init = false;
   scf->SkipWhite();
-  if (scf->CheckSymbol("="))  // variable initializer specified
+  if (scf->CheckTokSymbol("="))  // variable initializer specified
   {
     scf->SkipWhite();
     // Check for {} zero-initializer (for compound types)
-    if (scf->CheckSymbol("{"))
+    if (scf->CheckTokSymbol("{"))
     {
       scf->SkipWhite();
-      if (not scf->CheckSymbol("}"))
+      if (not scf->CheckTokSymbol("}"))
       {
         ErrorTxt(DQERR_EXPR_INITVALUE, "\"}\" expected for zero-initializer");
         return;
@@ -469,7 +618,7 @@ void ODqCompParser::ParseStmtVar(bool arootstmt)
   }
 
   scf->SkipWhite();
-  if (!scf->CheckSymbol(";"))
+  if (!scf->CheckTokSymbol(";"))
   {
     StatementError(DQERR_MISSING_SEMICOLON_TO_CLOSE, "variable declaration");
   }
@@ -519,7 +668,7 @@ void ODqCompParser::ParseStmtRef()
     return;
   }
 
-  pvalsym = curscope->FindValSym(sid, nullptr, false);
+  pvalsym = curscope->FindValSym(scf->previdentid, nullptr, false);
   if (pvalsym)
   {
     StatementError(DQERR_VS_ALREADY_DECL_TYPE, sid, pvalsym->ptype->name, &scf->prevpos);
@@ -527,7 +676,7 @@ void ODqCompParser::ParseStmtRef()
   }
 
   scf->SkipWhite();
-  if (scf->CheckSymbol(":"))
+  if (scf->CheckTokSymbol(":"))
   {
     ptype = ParseTypeSpec();
     if (!ptype)
@@ -537,7 +686,7 @@ void ODqCompParser::ParseStmtRef()
   }
 
   scf->SkipWhite();
-  if (!scf->CheckSymbol("="))
+  if (!scf->CheckTokSymbol("="))
   {
     StatementError(DQERR_REF_LOCAL_INIT_REQUIRED, sid);
     return;
@@ -578,7 +727,7 @@ void ODqCompParser::ParseStmtRef()
   }
 
   scf->SkipWhite();
-  if (!scf->CheckSymbol(";"))
+  if (!scf->CheckTokSymbol(";"))
   {
     StatementError(DQERR_MISSING_SEMICOLON_TO_CLOSE, "ref declaration");
   }
@@ -638,7 +787,7 @@ void ODqCompParser::ParseStmtConst(bool arootstmt)
   }
 
   scf->SkipWhite();
-  if (not scf->CheckSymbol(":"))
+  if (not scf->CheckTokSymbol(":"))
   {
     emit_error(DQERR_TYPE_SPECIFIER_EXP_AFTER, sid);
     return;
@@ -651,7 +800,7 @@ void ODqCompParser::ParseStmtConst(bool arootstmt)
   }
 
   scf->SkipWhite();
-  if (not scf->CheckSymbol("="))  // variable initializer specified
+  if (not scf->CheckTokSymbol("="))  // variable initializer specified
   {
     emit_error(DQERR_MISSING_ASSIGN_FOR, sid);
     return;
@@ -729,7 +878,7 @@ void ODqCompParser::ParseRootTypeDecl()
   }
 
   scf->SkipWhite();
-  if (not scf->CheckSymbol("="))
+  if (not scf->CheckTokSymbol("="))
   {
     RootStatementError(DQERR_MISSING_ASSIGN_FOR, sid);
     return;
@@ -788,7 +937,7 @@ void ODqCompParser::ParseStructDecl()
   {
     scf->SkipWhite();
 
-    if (scf->CheckSymbol("endstruct"))
+    if (scf->CheckTokKeyword(KW_ENDSTRUCT))
     {
       break;
     }
@@ -800,7 +949,7 @@ void ODqCompParser::ParseStructDecl()
     }
 
     scf->SkipWhite();
-    if (scf->CheckSymbol("endstruct"))
+    if (scf->CheckTokKeyword(KW_ENDSTRUCT))
     {
       if (attr->flags)
       {
@@ -818,7 +967,7 @@ void ODqCompParser::ParseStructDecl()
     }
 
     scf->SkipWhite();
-    if (not scf->CheckSymbol(":"))
+    if (not scf->CheckTokSymbol(":"))
     {
       StatementError(DQERR_TYPE_SPECIFIER_EXP_AFTER, membername);
       break;
@@ -834,7 +983,7 @@ void ODqCompParser::ParseStructDecl()
     }
 
     scf->SkipWhite();
-    if (not scf->CheckSymbol(";"))
+    if (not scf->CheckTokSymbol(";"))
     {
       StatementError(DQERR_MISSING_SEMICOLON_AFTER, "member definition");
       break;
@@ -921,12 +1070,12 @@ bool ODqCompParser::FinishFunctionDecl(OValSymFunc * vsfunc, OScope * decl_scope
   }
 
   scf->SkipWhite();
-  bool is_declaration_only = scf->CheckSymbol(";", false);
+  bool is_declaration_only = scf->CheckTokSymbol(";", false);
 
   auto consume_declaration_semicolon = [&](const string & what)
   {
     scf->SkipWhite();
-    if (not scf->CheckSymbol(";"))
+    if (not scf->CheckTokSymbol(";"))
     {
       Error(DQERR_FUNC_NO_BODY_ALLOWED_AFTER, what);
     }
@@ -935,7 +1084,7 @@ bool ODqCompParser::FinishFunctionDecl(OValSymFunc * vsfunc, OScope * decl_scope
   auto read_function_body = [&](OValSymFunc * bodyfunc)
   {
     curvsfunc = bodyfunc;
-    ReadStatementBlock(bodyfunc->body, "endfunc");
+    ReadStatementBlock(bodyfunc->body, {KW_ENDFUNC});
 
     bodyfunc->scpos_endfunc = scf->prevpos;
     bodyfunc->has_body = true;
@@ -1165,7 +1314,7 @@ void ODqCompParser::ParseObjectDecl()
   {
     scf->SkipWhite();
 
-    if (scf->CheckSymbol("endobj"))
+    if (scf->CheckTokKeyword(KW_ENDOBJ))
     {
       break;
     }
@@ -1177,7 +1326,7 @@ void ODqCompParser::ParseObjectDecl()
     }
 
     scf->SkipWhite();
-    if (scf->CheckSymbol("endobj"))
+    if (scf->CheckTokKeyword(KW_ENDOBJ))
     {
       if (attr->flags)
       {
@@ -1189,7 +1338,7 @@ void ODqCompParser::ParseObjectDecl()
     scf->SaveCurPos(mempos);
     scpos_statement_start = mempos;
 
-    if (scf->CheckSymbol("function"))
+    if (scf->CheckTokKeyword(KW_FUNCTION))
     {
       ReadObjectMethod(ctype);
       continue;
@@ -1202,7 +1351,7 @@ void ODqCompParser::ParseObjectDecl()
     }
 
     scf->SkipWhite();
-    if (not scf->CheckSymbol(":"))
+    if (not scf->CheckTokSymbol(":"))
     {
       StatementError(DQERR_TYPE_SPECIFIER_EXP_AFTER, membername);
       break;
@@ -1218,7 +1367,7 @@ void ODqCompParser::ParseObjectDecl()
     }
 
     scf->SkipWhite();
-    if (not scf->CheckSymbol(";"))
+    if (not scf->CheckTokSymbol(";"))
     {
       StatementError(DQERR_MISSING_SEMICOLON_AFTER, "member definition");
       break;
@@ -1290,7 +1439,7 @@ void ODqCompParser::ParseFunction()
   }
 
   scf->SkipWhite();
-  if (scf->CheckSymbol("."))
+  if (scf->CheckTokSymbol("."))
   {
     ParseQualifiedObjectFunction(sid);
     return;
@@ -1304,7 +1453,7 @@ void ODqCompParser::ParseFunction()
   FinishFunctionDecl(vsfunc, cur_mod_scope, cur_mod_scope, false, true, "function declaration");
 }
 
-void ODqCompParser::ReadStatementBlock(OStmtBlock * stblock, const string blockend, string * rendstr)
+void ODqCompParser::ReadStatementBlock(OStmtBlock * stblock, initializer_list<EKeyword> ablockends, EKeyword * rendkw)
 {
 
   OStmtBlock * prev_block = curblock;
@@ -1313,104 +1462,140 @@ void ODqCompParser::ReadStatementBlock(OStmtBlock * stblock, const string blocke
   curblock = stblock;
   curscope = stblock->scope;
 
-  string block_closer;
-  string sid;
+  bool brace_block = false;
+
+  if (rendkw)  *rendkw = KW_NONE;
 
   scf->SkipWhite();
-  if (scf->CheckSymbol("{"))
+  if (scf->CheckTokSymbol("{"))
   {
-    block_closer = "}";
+    brace_block = true;
   }
-  else if (scf->CheckSymbol(":"))
+  else if (scf->CheckTokSymbol(":"))
   {
-    block_closer = blockend;
+    // closed by one of the ablockends
   }
   else
   {
     StatementError(DQERR_STMTBLK_START_MISSING);
-    block_closer = blockend;
   }
 
-  bool endfound = false;
   while (not scf->Eof())
   {
     scf->SkipWhite();
 
-    auto split_view = block_closer | views::split('|');
-    for (auto chunk : split_view)
+    // the block closers are compared by the token id: "endif", "elif", "else" or "}"
+    if (brace_block)
     {
-      string chunkstr = string(string_view(chunk));
-      if (scf->CheckSymbol(chunkstr.c_str()))
+      if (scf->CheckTokSymbol("}"))
       {
-        endfound = true;
-        if (rendstr)  *rendstr = chunkstr;
         break;
       }
     }
-
-    if (endfound)
+    else
     {
-      break;  // block closer was found
+      EKeyword endkw = scf->CurKeyword();
+      if ((KW_NONE != endkw) and (ranges::find(ablockends, endkw) != ablockends.end()))
+      {
+        scf->CheckTokKeyword(endkw);
+        if (rendkw)  *rendkw = endkw;
+        break;
+      }
     }
 
     if (scf->Eof())
     {
-      if (rendstr)  *rendstr = "";
+      string block_closer = (brace_block ? "}" : "");
+      if (not brace_block)
+      {
+        for (EKeyword kw : ablockends)
+        {
+          block_closer += (block_closer.empty() ? "" : "|") + string(KeywordName(kw));
+        }
+      }
       StatementError(DQERR_STMTBLK_CLOSE_MISSING, block_closer);
       break;
     }
 
     scf->SaveCurPos(scpos_statement_start);
 
-    if (scf->CheckSymbol(";"))  // empty ";", just ignore it
+    if (scf->CheckTokSymbol(";"))  // empty ";", just ignore it
     {
       Hint(DQHINT_MEANINGLESS_SEMICOLON);
       continue;
     }
 
-    // Try keywords first, use ReadIdentifier for whole word checking
+    // statement attributes, only the loops use them: [[unroll(4)]] while ...
+    OAttr stmtattr;
+    if (scf->CheckTokSymbol("[[", false))
+    {
+      OAttr * prev_attr = attr;  // keep the attributes of the enclosing declaration
+      attr = &stmtattr;
+      bool attrok = ParseAttributes(false);
+      attr = prev_attr;
+      if (!attrok)
+      {
+        continue;
+      }
+      scf->SkipWhite();
+
+      EKeyword kw = scf->CurKeyword();
+      if ((KW_WHILE != kw) and (KW_FOR != kw))
+      {
+        stmtattr.CheckInvalidAttributes(ATGT_STATEMENT);
+      }
+    }
+
+    // Try keywords first, the identifier token at the cursor is compared by its interned id
 
-    scf->SaveCurPos(scpos_statement_start);  // we jump back here if the identifier is unknown
-    if (scf->ReadIdentifier(sid))
+    scf->SaveCurPos(scpos_statement_start);  // we jump back here if the keyword does not start a statement
+    EKeyword kw = scf->CurKeyword();
+    if (KW_NONE != kw)
     {
-      if ("var" == sid)  // local variable declaration
+      scf->CheckTokKeyword(kw);
+      if (KW_VAR == kw)  // local variable declaration
       {
         ParseStmtVar(false);
         continue;
       }
-      else if ("ref" == sid)
+      else if (KW_REF == kw)
       {
         ParseStmtRef();
         continue;
       }
-      else if ("refin" == sid || "refout" == sid || "refnull" == sid)
+      else if ((KW_REFIN == kw) or (KW_REFOUT == kw) or (KW_REFNULL == kw))
       {
-        StatementError(DQERR_REF_LOCAL_MODE_UNSUPPORTED, sid);
+        StatementError(DQERR_REF_LOCAL_MODE_UNSUPPORTED, KeywordName(kw));
         continue;
       }
-      else if ("const" == sid)
+      else if (KW_CONST == kw)
       {
         ParseStmtConst(false);
         continue;
       }
-      else if ("return" == sid)
+      else if (KW_RETURN == kw)
       {
         ParseStmtReturn();
         continue;
       }
-      else if ("while" == sid)
+      else if (KW_WHILE == kw)
+      {
+        ParseStmtWhile(&stmtattr);
+        continue;
+      }
+      else if (KW_FOR == kw)
       {
-        ParseStmtWhile();
+        ParseStmtFor(&stmtattr);
         continue;
       }
-      else if ("if" == sid)
+      else if (KW_IF == kw)
       {
         ParseStmtIf();
         continue;
       }
-      else if (ReservedWord(sid))
+      else if (KeywordFlags(kw) & KWF_RESERVED)
       {
-        StatementError(DQERR_STMT_INVALID, sid);
+        StatementError(DQERR_STMT_INVALID, KeywordName(kw));
         continue;
       }
       else  // not handled, restore position and go on with expression parsing
@@ -1469,7 +1654,7 @@ void ODqCompParser::ReadStatementBlock(OStmtBlock * stblock, const string blocke
       }
 
       scf->SkipWhite();
-      if (!scf->CheckSymbol(";"))
+      if (!scf->CheckTokSymbol(";"))
       {
         OScPosition scpos;
         scf->SaveCurPos(scpos);
@@ -1491,6 +1676,27 @@ void ODqCompParser::ReadStatementBlock(OStmtBlock * stblock, const string blocke
       continue;
     }
 
+    // vstore() writes memory like an assignment
+    if (auto * vstore = dynamic_cast<OVecStoreExpr *>(leftexpr))
+    {
+      EmitFilteredAssignVarInitDiags(vstore->elemref, BINOP_NONE);
+      scf->SkipWhite();
+      if (!scf->CheckTokSymbol(";"))
+      {
+        OScPosition scpos;
+        scf->SaveCurPos(scpos);
+        StatementError(DQERR_MISSING_SEMICOLON_TO_CLOSE, "vstore() statement", &scpos);
+      }
+      CheckPureFuncWrite(vstore->elemref);
+      OValSym * rootvalsym = GetAssignRootValSym(vstore->elemref);
+      if (rootvalsym && (VSK_VARIABLE == rootvalsym->kind || VSK_PARAMETER == rootvalsym->kind))
+      {
+        curblock->scope->SetVarInitialized(rootvalsym);
+      }
+      FinalizeStmtVoidCall(leftexpr);
+      continue;
+    }
+
     // the leftexpr should be a callable expression
     bool is_call_stmt = (dynamic_cast<OCallExpr *>(leftexpr) != nullptr)
                      || (dynamic_cast<OIndirectCallExpr *>(leftexpr) != nullptr);
@@ -1499,7 +1705,7 @@ void ODqCompParser::ReadStatementBlock(OStmtBlock * stblock, const string blocke
       EmitSuppressedVarInitDiags();
       StatementError(DQERR_STMT_ASSIGN_OR_FCALL_EXP);
       scf->SkipWhite();
-      if (!scf->CheckSymbol(";"))
+      if (!scf->CheckTokSymbol(";"))
       {
         SkipToStatementEnd();
       }
@@ -1509,7 +1715,7 @@ void ODqCompParser::ReadStatementBlock(OStmtBlock * stblock, const string blocke
 
     EmitSuppressedVarInitDiags();
     scf->SkipWhite();
-    if (!scf->CheckSymbol(";"))
+    if (!scf->CheckTokSymbol(";"))
     {
       OScPosition scpos;
       scf->SaveCurPos(scpos);
@@ -1531,7 +1737,7 @@ OType * ODqCompParser::ParseTypeSpec(bool aemit_errors)
 
   int pointer_level = 0;
   scf->SkipWhite();
-  while (scf->CheckSymbol("^"))
+  while (scf->CheckTokSymbol("^"))
   {
     ++pointer_level;
     scf->SkipWhite();
@@ -1542,7 +1748,7 @@ OType * ODqCompParser::ParseTypeSpec(bool aemit_errors)
   OType * ptype = nullptr;
   string stype;
 
-  if (scf->CheckSymbol("function"))
+  if (scf->CheckTokKeyword(KW_FUNCTION))
   {
     OTypeFunc * sigtype = ParseFunctionType(aemit_errors, "function");
     if (!sigtype)
@@ -1551,10 +1757,10 @@ OType * ODqCompParser::ParseTypeSpec(bool aemit_errors)
     }
 
     scf->SkipWhite();
-    if (scf->CheckSymbol("of"))
+    if (scf->CheckTokKeyword(KW_OF))
     {
       scf->SkipWhite();
-      if (scf->CheckSymbol("object"))
+      if (scf->CheckTokKeyword(KW_OBJECT))
       {
         if (aemit_errors)
         {
@@ -1606,11 +1812,11 @@ OType * ODqCompParser::ParseTypeSpec(bool aemit_errors)
   if (TK_STRING == ptype->kind and not is_pointer)
   {
     scf->SkipWhite();
-    if (scf->CheckSymbol("[[", false))
+    if (scf->CheckTokSymbol("[[", false))
     {
       return ptype;
     }
-    if (scf->CheckSymbol("["))
+    if (scf->CheckTokSymbol("["))
     {
       int64_t maxlen;
       if (not scf->ReadInt64Value(maxlen))
@@ -1630,7 +1836,7 @@ OType * ODqCompParser::ParseTypeSpec(bool aemit_errors)
         return nullptr;
       }
       scf->SkipWhite();
-      if (not scf->CheckSymbol("]"))
+      if (not scf->CheckTokSymbol("]"))
       {
         if (aemit_errors)
         {
@@ -1645,11 +1851,11 @@ OType * ODqCompParser::ParseTypeSpec(bool aemit_errors)
 
   // Check for array suffix: [N] or []
   scf->SkipWhite();
-  if (scf->CheckSymbol("[[", false))
+  if (scf->CheckTokSymbol("[[", false))
   {
     return ptype;
   }
-  if (scf->CheckSymbol("["))
+  if (scf->CheckTokSymbol("["))
   {
     if (is_pointer)
     {
@@ -1661,19 +1867,19 @@ OType * ODqCompParser::ParseTypeSpec(bool aemit_errors)
     }
 
     scf->SkipWhite();
-    if (scf->CheckSymbol("]"))
+    if (scf->CheckTokSymbol("]"))
     {
       // Empty brackets: type[] — array slice
       ptype = ptype->GetSliceType();
     }
-    else if (scf->CheckSymbol("..."))
+    else if (scf->CheckTokSymbol("..."))
     {
       if (aemit_errors)
       {
         Error(DQERR_NOT_IMPLEMENTED_YET, "Dynamic array (int[...])");
       }
       scf->ReadTo("]");
-      scf->CheckSymbol("]");
+      scf->CheckTokSymbol("]");
       return nullptr;
     }
     else
@@ -1697,7 +1903,7 @@ OType * ODqCompParser::ParseTypeSpec(bool aemit_errors)
         return nullptr;
       }
       scf->SkipWhite();
-      if (not scf->CheckSymbol("]"))
+      if (not scf->CheckTokSymbol("]"))
       {
         if (aemit_errors)
         {
@@ -1734,7 +1940,7 @@ bool ODqCompParser::ParseFunctionSignature(OTypeFunc * tfunc, bool atypespec, co
   };
 
   scf->SkipWhite();
-  bool has_param_list = scf->CheckSymbol("(");
+  bool has_param_list = scf->CheckTokSymbol("(");
   if (!has_param_list)
   {
     if (atypespec)
@@ -1754,14 +1960,14 @@ bool ODqCompParser::ParseFunctionSignature(OTypeFunc * tfunc, bool atypespec, co
     while (not scf->Eof())
     {
       scf->SkipWhite();
-      if (scf->CheckSymbol(")"))
+      if (scf->CheckTokSymbol(")"))
       {
         break;
       }
 
       if (!tfunc->params.empty())
       {
-        if (!scf->CheckSymbol(","))
+        if (!scf->CheckTokSymbol(","))
         {
           if (aemit_errors)
           {
@@ -1776,11 +1982,11 @@ bool ODqCompParser::ParseFunctionSignature(OTypeFunc * tfunc, bool atypespec, co
         scf->SkipWhite();
       }
 
-      if (scf->CheckSymbol("..."))
+      if (scf->CheckTokSymbol("..."))
       {
         tfunc->has_varargs = true;
         scf->SkipWhite();
-        if (!scf->CheckSymbol(")"))
+        if (!scf->CheckTokSymbol(")"))
         {
           if (aemit_errors)
           {
@@ -1810,7 +2016,7 @@ bool ODqCompParser::ParseFunctionSignature(OTypeFunc * tfunc, bool atypespec, co
       }
 
       spname = pname_or_mode;
-      if (ParseParamModeKeyword(pname_or_mode, pmode))
+      if (ParseParamModeKeyword(KeywordOfId(scf->previdentid), pmode))
       {
         scf->SkipWhite();
         if (!scf->ReadIdentifier(spname))
@@ -1841,7 +2047,7 @@ bool ODqCompParser::ParseFunctionSignature(OTypeFunc * tfunc, bool atypespec, co
       }
 
       scf->SkipWhite();
-      if (!scf->CheckSymbol(":"))
+      if (!scf->CheckTokSymbol(":"))
       {
         if (aemit_errors)
         {
@@ -1872,7 +2078,7 @@ bool ODqCompParser::ParseFunctionSignature(OTypeFunc * tfunc, bool atypespec, co
       OFuncParam * fparam = tfunc->AddParam(spname, ptype, pmode);
 
       scf->SkipWhite();
-      if (scf->CheckSymbol("="))
+      if (scf->CheckTokSymbol("="))
       {
         if (ParamModeIsRefLike(pmode))
         {
@@ -2009,7 +2215,7 @@ bool ODqCompParser::ParseFunctionSignature(OTypeFunc * tfunc, bool atypespec, co
   }
 
   scf->SkipWhite();
-  if (scf->CheckSymbol("->"))
+  if (scf->CheckTokSymbol("->"))
   {
     tfunc->rettype = ParseTypeSpec(aemit_errors);
     if (!tfunc->rettype)
@@ -2038,7 +2244,7 @@ void ODqCompParser::ParseStmtReturn()
 {
   // "return" is already consumed.
   scf->SkipWhite();
-  if (scf->CheckSymbol(";"))  // return without value, use the result variable to return
+  if (scf->CheckTokSymbol(";"))  // return without value, use the result variable to return
   {
     curblock->AddStatement(new OStmtReturn(scpos_statement_start, nullptr, curvsfunc));
     return;
@@ -2052,7 +2258,7 @@ void ODqCompParser::ParseStmtReturn()
 
   OExpr * expr = ParseExpression();
   scf->SkipWhite();
-  if (!scf->CheckSymbol(";"))
+  if (!scf->CheckTokSymbol(";"))
   {
     Error(DQERR_MISSING_SEMICOLON_AFTER, "the return expression");
   }
@@ -2063,7 +2269,7 @@ void ODqCompParser::ParseStmtReturn()
   }
 }
 
-void ODqCompParser::ParseStmtWhile()
+void ODqCompParser::ParseStmtWhile(OAttr * aloopattr)
 {
   // note: "while" is already consumed
   // syntax form: "while <condition>: <statement_block> endwhile"
@@ -2078,11 +2284,99 @@ void ODqCompParser::ParseStmtWhile()
   }
 
   OStmtWhile * st = new OStmtWhile(scpos_statement_start, cond, curscope);
+  st->hints.ApplyAttributes(aloopattr);
   curblock->AddStatement(st);
 
-  ReadStatementBlock(st->body, "endwhile");
+  ReadStatementBlock(st->body, {KW_ENDWHILE});
+
+  st->body->scope->RevertFirstAssignments();
+}
+
+void ODqCompParser::ParseStmtFor(OAttr * aloopattr)
+{
+  // note: "for" is already consumed
+  // syntax form: "for <identifier> in <start>..<end>: <statement_block> endfor"
+
+  string sid;
+  scf->SkipWhite();
+  if (not scf->ReadIdentifier(sid))
+  {
+    StatementError(DQERR_ID_EXP_AFTER, "for");
+    return;
+  }
+
+  bool     headerok = true;
+  OExpr *  startexpr = nullptr;
+  OExpr *  endexpr = nullptr;
+
+  string sin;
+  scf->SkipWhite();
+  if (not scf->ReadIdentifier(sin) or ("in" != sin))
+  {
+    Error(DQERR_FOR_IN_EXPECTED, sid);
+    headerok = false;
+  }
+
+  if (headerok)
+  {
+    scf->SkipWhite();
+    startexpr = ParseExpression();
+    scf->SkipWhite();
+    if (startexpr and scf->CheckTokSymbol(".."))
+    {
+      scf->SkipWhite();
+      endexpr = ParseExpression();
+    }
+    if (!startexpr or !endexpr)
+    {
+      Error(DQERR_FOR_RANGE_EXPECTED);
+      headerok = false;
+    }
+  }
+
+  for (OExpr ** pexpr : {&startexpr, &endexpr})
+  {
+    if (!headerok)
+    {
+      break;
+    }
+    if (TK_INT != (*pexpr)->ResolvedType()->kind)
+    {
+      Error(DQERR_FOR_RANGE_TYPE, (*pexpr)->ResolvedType()->name);
+      headerok = false;
+    }
+    else if (not CheckAssignType(g_builtins->type_int, pexpr, "for range"))
+    {
+      headerok = false;
+    }
+  }
+
+  if (!headerok)
+  {
+    scf->ReadTo(":{");  // error recovery: the body is parsed for the diagnostics only
+  }
+
+  OStmtFor * st = new OStmtFor(scpos_statement_start, startexpr, endexpr, curscope);
+  st->hints.ApplyAttributes(aloopattr);
+  if (headerok)
+  {
+    curblock->AddStatement(st);
+  }
+
+  // the loop variable belongs to the body scope, it can not be modified there
+  st->loopvar = g_builtins->type_int->CreateValSym(scpos_statement_start, sid);
+  st->loopvar->initialized = true;
+  st->loopvar->is_readonly = true;
+  st->body->scope->DefineValSym(st->loopvar);
+
+  ReadStatementBlock(st->body, {KW_ENDFOR});
 
   st->body->scope->RevertFirstAssignments();
+
+  if (!headerok)
+  {
+    delete st;
+  }
 }
 
 void ODqCompParser::ParseStmtIf()
@@ -2110,16 +2404,16 @@ void ODqCompParser::ParseStmtIf()
 
   while (not scf->Eof())
   {
-    string endstr = "";
-    ReadStatementBlock(branch->body, "endif|elif|else", &endstr);
+    EKeyword endkw;
+    ReadStatementBlock(branch->body, {KW_ENDIF, KW_ELIF, KW_ELSE}, &endkw);
     branch->body->scope->RevertFirstAssignments();
 
-    if ("endif" == endstr)
+    if (KW_ENDIF == endkw)
     {
       break;  // if closed
     }
 
-    if ("elif" == endstr)
+    if (KW_ELIF == endkw)
     {
       cond = ParseExpression();
       if (!cond)
@@ -2137,7 +2431,7 @@ void ODqCompParser::ParseStmtIf()
       continue;
     }
 
-    if ("else" == endstr)
+    if (KW_ELSE == endkw)
     {
       if (st->else_present)
       {
@@ -2149,22 +2443,11 @@ void ODqCompParser::ParseStmtIf()
       continue;
     }
 
-    if ("}" == endstr) // for braces mode
+    if (KW_NONE == endkw) // for braces mode: "}" (or the end of the file)
     {
       scf->SkipWhite();
-      if (scf->CheckSymbol("endif"))
-      {
-        endstr = "endif";
-        continue;
-      }
-      if (scf->CheckSymbol("elif"))
-      {
-        endstr = "elif";
-        continue;
-      }
-      if (scf->CheckSymbol("else"))
+      if (scf->CheckTokKeyword(KW_ENDIF) or scf->CheckTokKeyword(KW_ELIF) or scf->CheckTokKeyword(KW_ELSE))
       {
-        endstr = "else";
         continue;
       }
     }
@@ -2214,7 +2497,7 @@ OExpr * ODqCompParser::ParseExprOr()
   while (not scf->Eof())
   {
     scf->SkipWhite();
-    if (scf->CheckSymbol("or"))
+    if (scf->CheckTokKeyword(KW_OR))
     {
       OExpr * right = ParseExprAnd();
       if (!right)
@@ -2238,7 +2521,7 @@ OExpr * ODqCompParser::ParseExprAnd()
   while (not scf->Eof())
   {
     scf->SkipWhite();
-    if (scf->CheckSymbol("and"))
+    if (scf->CheckTokKeyword(KW_AND))
     {
       OExpr * right = ParseExprNot(); // Fixed recursion to ParseExprNot (was ParseExprAnd in original logic, but usually it chains to next priority or self)
       if (!right)
@@ -2257,7 +2540,7 @@ OExpr * ODqCompParser::ParseExprAnd()
 OExpr * ODqCompParser::ParseExprNot()
 {
   scf->SkipWhite();
-  if (scf->CheckSymbol("not"))
+  if (scf->CheckTokKeyword(KW_NOT))
   {
     OExpr *  val = ParseExprNot();
     if (!val)
@@ -2283,18 +2566,18 @@ OExpr * ODqCompParser::ParseComparison()
   ECompareOp op = COMPOP_NONE;
 
   // check first the ambigous expression terminators
-  if (scf->CheckSymbol("<<=", false) or scf->CheckSymbol(">>=", false))
+  if (scf->CheckTokSymbol("<<=", false) or scf->CheckTokSymbol(">>=", false))
   {
     return left;
   }
 
-  if      (scf->CheckSymbol("=="))    op = COMPOP_EQ;
-  else if (scf->CheckSymbol("!=") or
-           scf->CheckSymbol("<>"))    op = COMPOP_NE;
-  else if (scf->CheckSymbol("<="))    op = COMPOP_LE;  // <= before <
-  else if (scf->CheckSymbol("<"))     op = COMPOP_LT;
-  else if (scf->CheckSymbol(">="))    op = COMPOP_GE;  // >= before >
-  else if (scf->CheckSymbol(">"))     op = COMPOP_GT;
+  if      (scf->CheckTokSymbol("=="))    op = COMPOP_EQ;
+  else if (scf->CheckTokSymbol("!=") or
+           scf->CheckTokSymbol("<>"))    op = COMPOP_NE;
+  else if (scf->CheckTokSymbol("<="))    op = COMPOP_LE;  // <= before <
+  else if (scf->CheckTokSymbol("<"))     op = COMPOP_LT;
+  else if (scf->CheckTokSymbol(">="))    op = COMPOP_GE;  // >= before >
+  else if (scf->CheckTokSymbol(">"))     op = COMPOP_GT;
   else
   {
     return left;
@@ -2306,6 +2589,11 @@ OExpr * ODqCompParser::ParseComparison()
     return FreeLeftRight(left, nullptr);
   }
 
+  if (left->IsVector() or right->IsVector())
+  {
+    return CreateVectorCompareExpr(op, left, right);
+  }
+
   HarmonizeNumericOperands(&left, &right);
 
   return new OCompareExpr(op, left, right);
@@ -2323,12 +2611,12 @@ OExpr * ODqCompParser::ParseBinOpLevel(OExpr * (ODqCompParser::*parse_next)(), c
     scf->SkipWhite();
 
     // check first the ambigous expression terminators
-    if (    scf->CheckSymbol("+=", false)
-         or scf->CheckSymbol("-=", false)
-         or scf->CheckSymbol("*=", false)
-         or scf->CheckSymbol("/=", false)
-         or scf->CheckSymbol("<<=", false)
-         or scf->CheckSymbol(">>=", false)  )
+    if (    scf->CheckTokSymbol("+=", false)
+         or scf->CheckTokSymbol("-=", false)
+         or scf->CheckTokSymbol("*=", false)
+         or scf->CheckTokSymbol("/=", false)
+         or scf->CheckTokSymbol("<<=", false)
+         or scf->CheckTokSymbol(">>=", false)  )
     {
       break;
     }
@@ -2337,7 +2625,7 @@ OExpr * ODqCompParser::ParseBinOpLevel(OExpr * (ODqCompParser::*parse_next)(), c
     bool blocked_assignop = false;
     for (int i = 0; i < nops; ++i)
     {
-      if (scf->CheckSymbol(ops[i].sym))
+      if (ops[i].kw ? scf->CheckTokKeyword(ops[i].kw) : scf->CheckTokSymbol(ops[i].sym))
       {
         op = ops[i].op;
         break;
@@ -2355,37 +2643,37 @@ OExpr * ODqCompParser::ParseBinOpLevel(OExpr * (ODqCompParser::*parse_next)(), c
 
 OExpr * ODqCompParser::ParseExprAdd()
 {
-  static const BinOpEntry ops[] = { {"+", BINOP_ADD}, {"-", BINOP_SUB} };
+  static const BinOpEntry ops[] = { {"+", KW_NONE, BINOP_ADD}, {"-", KW_NONE, BINOP_SUB} };
   return ParseBinOpLevel(&ODqCompParser::ParseExprMul, ops, 2);
 }
 
 OExpr * ODqCompParser::ParseExprMul()
 {
-  static const BinOpEntry ops[] = { {"*", BINOP_MUL} };
+  static const BinOpEntry ops[] = { {"*", KW_NONE, BINOP_MUL} };
   return ParseBinOpLevel(&ODqCompParser::ParseExprDiv, ops, 1);
 }
 
 OExpr * ODqCompParser::ParseExprDiv()
 {
-  static const BinOpEntry ops[] = { {"/", BINOP_DIV}, {"IDIV", BINOP_IDIV}, {"IMOD", BINOP_IMOD} };
+  static const BinOpEntry ops[] = { {"/", KW_NONE, BINOP_DIV}, {nullptr, KW_IDIV, BINOP_IDIV}, {nullptr, KW_IMOD, BINOP_IMOD} };
   return ParseBinOpLevel(&ODqCompParser::ParseExprBinOr, ops, 3);
 }
 
 OExpr * ODqCompParser::ParseExprBinOr()
 {
-  static const BinOpEntry ops[] = { {"OR", BINOP_IOR}, {"XOR", BINOP_IXOR} };
+  static const BinOpEntry ops[] = { {nullptr, KW_BIN_OR, BINOP_IOR}, {nullptr, KW_BIN_XOR, BINOP_IXOR} };
   return ParseBinOpLevel(&ODqCompParser::ParseExprBinAnd, ops, 2);
 }
 
 OExpr * ODqCompParser::ParseExprBinAnd()
 {
-  static const BinOpEntry ops[] = { {"AND", BINOP_IAND} };
+  static const BinOpEntry ops[] = { {nullptr, KW_BIN_AND, BINOP_IAND} };
   return ParseBinOpLevel(&ODqCompParser::ParseExprShift, ops, 1);
 }
 
 OExpr * ODqCompParser::ParseExprShift()
 {
-  static const BinOpEntry ops[] = { {"<<", BINOP_ISHL}, {"SHL", BINOP_ISHL}, {">>", BINOP_ISHR}, {"SHR", BINOP_ISHR} };
+  static const BinOpEntry ops[] = { {"<<", KW_NONE, BINOP_ISHL}, {nullptr, KW_SHL, BINOP_ISHL}, {">>", KW_NONE, BINOP_ISHR}, {nullptr, KW_SHR, BINOP_ISHR} };
   return ParseBinOpLevel(&ODqCompParser::ParseExprUnary, ops, 4);
 }
 
@@ -2394,21 +2682,30 @@ OExpr * ODqCompParser::ParseExprUnary()
   scf->SkipWhite();
 
   // address-of operator: consume a full postfix-capable lvalue operand
-  if (scf->CheckSymbol("&"))
+  if (scf->CheckTokSymbol("&"))
   {
     OLValueExpr * lval = ParseAddressableExpr();
     if (!lval) return nullptr;
+
+    // a write through the pointer would bypass the read-only check (the for loop ranges rely on it)
+    OValSym * rootvalsym = GetAssignRootValSym(lval);
+    if (rootvalsym and rootvalsym->is_readonly)
+    {
+      Error(DQERR_ADDR_OF_READONLY, rootvalsym->name);
+      delete lval;
+      return nullptr;
+    }
     return new OAddrOfExpr(lval);
   }
 
-  if (scf->CheckSymbol("-"))
+  if (scf->CheckTokSymbol("-"))
   {
     OExpr * val = ParseExprUnary();
     if (!val) return nullptr;
     return new ONegExpr(val);
   }
 
-  if (scf->CheckSymbol("NOT"))
+  if (scf->CheckTokKeyword(KW_BIN_NOT))
   {
     OExpr * val = ParseExprUnary();
     if (!val) return nullptr;
@@ -2467,7 +2764,7 @@ OExpr * ODqCompParser::ParseExplicitCastExpr(bool * rattempted)
   }
 
   scf->SkipWhite();
-  if (!scf->CheckSymbol("("))
+  if (!scf->CheckTokSymbol("("))
   {
     scf->SetCurPos(saved_pos);
     return nullptr;
@@ -2485,7 +2782,7 @@ OExpr * ODqCompParser::ParseExplicitCastExpr(bool * rattempted)
   }
 
   scf->SkipWhite();
-  if (!scf->CheckSymbol(")"))
+  if (!scf->CheckTokSymbol(")"))
   {
     delete srcexpr;
     Error(DQERR_MISSING_CLOSE_PAREN_FOR, "cast");
@@ -2521,7 +2818,7 @@ OExpr * ODqCompParser::ParsePostfix(OExpr * base)
     if (lval)
     {
       // Struct member access on a compound lvalue or a ^compound pointer: x.field / p.field
-      if (scf->CheckSymbol("."))
+      if (not scf->CheckTokSymbol("..", false) and scf->CheckTokSymbol("."))  // ".." is the range operator
       {
         OLValueExpr * memberbase = nullptr;
         OCompoundType * ctype = nullptr;
@@ -2541,6 +2838,11 @@ OExpr * ODqCompParser::ParsePostfix(OExpr * base)
           return result;
         }
 
+        if (memberbase != lval)
+        {
+          CheckReadnoneDeref("a pointer");
+        }
+
         string membername;
         scf->SkipWhite();
         if (not scf->ReadIdentifier(membername))
@@ -2549,10 +2851,10 @@ OExpr * ODqCompParser::ParsePostfix(OExpr * base)
           return result;
         }
 
-        OValSym * objsym = (ctype->is_object ? ctype->Members()->FindValSym(membername, nullptr, false) : nullptr);
+        OValSym * objsym = (ctype->is_object ? ctype->Members()->FindValSym(scf->previdentid, nullptr, false) : nullptr);
         if (auto * method = dynamic_cast<OValSymFunc *>(objsym))
         {
-          if (!scf->CheckSymbol("("))
+          if (!scf->CheckTokSymbol("("))
           {
             Error(DQERR_FUNC_CALL_PARENTH, membername);
             return result;
@@ -2565,7 +2867,7 @@ OExpr * ODqCompParser::ParsePostfix(OExpr * base)
         }
         if (auto * ovset = dynamic_cast<OValSymOverloadSet *>(objsym))
         {
-          if (!scf->CheckSymbol("("))
+          if (!scf->CheckTokSymbol("("))
           {
             Error(DQERR_FUNC_CALL_PARENTH, membername);
             return result;
@@ -2588,17 +2890,29 @@ OExpr * ODqCompParser::ParsePostfix(OExpr * base)
         continue;
       }
 
-      // Array/slice/cstring index on any lvalue: x[i]
-      if ((TK_ARRAY == tk or TK_ARRAY_SLICE == tk or TK_STRING == tk)
-          and scf->CheckSymbol("["))
+      // Array/slice/cstring/vector index on any lvalue: x[i]
+      if ((TK_ARRAY == tk or TK_ARRAY_SLICE == tk or TK_STRING == tk or TK_VECTOR == tk)
+          and scf->CheckTokSymbol("["))
       {
+        if ((TK_VECTOR == tk) and static_cast<OTypeVector *>(lval->ptype)->IsMask())
+        {
+          Error(DQERR_OP_INVALID_FOR, "[]", lval->ptype->name);  // the mask lanes are not addressable
+          delete result;
+          return nullptr;
+        }
+        OScPosition indexpos;
+        scf->SaveCurPos(indexpos);
         OExpr * indexexpr = ParseExpression();
         scf->SkipWhite();
-        if (not scf->CheckSymbol("]"))
+        if (not scf->CheckTokSymbol("]"))
         {
           Error(DQERR_MISSING_CLOSE_BRACKET_AFTER, "index");
         }
-        result = new OLValueIndex(lval, lval->ptype, indexexpr);
+        if ((TK_ARRAY_SLICE == tk) or ((TK_STRING == tk) and (0 == static_cast<OTypeCString *>(lval->ResolvedType())->maxlen)))
+        {
+          CheckReadnoneDeref(TK_ARRAY_SLICE == tk ? "a slice" : "an unsized cstring");
+        }
+        result = new OLValueIndex(indexpos, lval, lval->ptype, indexexpr);
         continue;
       }
 
@@ -2606,7 +2920,7 @@ OExpr * ODqCompParser::ParsePostfix(OExpr * base)
       OLValueVar * varref = dynamic_cast<OLValueVar *>(lval);
       if (varref)
       {
-        if (dynamic_cast<OValSymOverloadSet *>(varref->pvalsym) && scf->CheckSymbol("("))
+        if (dynamic_cast<OValSymOverloadSet *>(varref->pvalsym) && scf->CheckTokSymbol("("))
         {
           OExpr * callexpr = ParseExprOverloadCall(static_cast<OValSymOverloadSet *>(varref->pvalsym));
           delete result;
@@ -2616,7 +2930,7 @@ OExpr * ODqCompParser::ParsePostfix(OExpr * base)
         }
 
         OValSymFunc * vsfunc = dynamic_cast<OValSymFunc *>(varref->pvalsym);
-        if (vsfunc && scf->CheckSymbol("("))
+        if (vsfunc && scf->CheckTokSymbol("("))
         {
           OExpr * callexpr = ParseExprFuncCall(vsfunc);
           delete result;
@@ -2627,11 +2941,11 @@ OExpr * ODqCompParser::ParsePostfix(OExpr * base)
       }
     }
 
-    if (scf->CheckSymbol("(", false))
+    if (scf->CheckTokSymbol("(", false))
     {
       if (TK_FUNCREF == tk)
       {
-        scf->CheckSymbol("(");
+        scf->CheckTokSymbol("(");
         OTypeFuncRef * calltype = static_cast<OTypeFuncRef *>(result->ResolvedType());
         OExpr * callexpr = ParseExprIndirectCall(result, calltype);
         result = callexpr;
@@ -2648,7 +2962,7 @@ OExpr * ODqCompParser::ParsePostfix(OExpr * base)
     if (TK_POINTER == tk)
     {
       OTypePointer * ptrtype = static_cast<OTypePointer *>(result->ResolvedType());
-      if (scf->CheckSymbol("[")) // p[i]: pointer indexing, no dereference
+      if (scf->CheckTokSymbol("[")) // p[i]: pointer indexing, no dereference
       {
         if (!ptrtype->IsTypedPointer())
         {
@@ -2659,7 +2973,7 @@ OExpr * ODqCompParser::ParsePostfix(OExpr * base)
 
         OExpr * indexexpr = ParseExpression();
         scf->SkipWhite();
-        if (not scf->CheckSymbol("]"))
+        if (not scf->CheckTokSymbol("]"))
         {
           Error(DQERR_MISSING_CLOSE_BRACKET_AFTER, "pointer index");
         }
@@ -2667,7 +2981,7 @@ OExpr * ODqCompParser::ParsePostfix(OExpr * base)
         continue;
       }
 
-      if (scf->CheckSymbol("^")) // p^: dereference -> lvalue
+      if (scf->CheckTokSymbol("^")) // p^: dereference -> lvalue
       {
         if (!ptrtype->IsTypedPointer())
         {
@@ -2675,6 +2989,7 @@ OExpr * ODqCompParser::ParsePostfix(OExpr * base)
           delete result;
           return nullptr;
         }
+        CheckReadnoneDeref("a pointer");
         result = new OLValueDeref(result);
         continue;
       }
@@ -2692,10 +3007,7 @@ OExpr * ODqCompParser::ParseExprPrimary()
 
   scf->SkipWhite();
 
-  if (*scf->curp == '^'
-      || ((*scf->curp >= 'A' && *scf->curp <= 'Z')
-          || (*scf->curp >= 'a' && *scf->curp <= 'z')
-          || (*scf->curp == '_')))
+  if (scf->CheckTokSymbol("^", false) or (scf->CurIdentId() >= 0))
   {
     bool attempted_cast = false;
     result = ParseExplicitCastExpr(&attempted_cast);
@@ -2709,18 +3021,18 @@ OExpr * ODqCompParser::ParseExprPrimary()
     }
   }
 
-  if (scf->CheckSymbol("("))
+  if (scf->CheckTokSymbol("("))
   {
     result = ParseExpression();
     scf->SkipWhite();
-    if (!scf->CheckSymbol(")"))
+    if (!scf->CheckTokSymbol(")"))
     {
       Error(DQERR_MISSING_CLOSE_PAREN);
     }
     return result;
   }
 
-  if (scf->CheckSymbol("["))
+  if (scf->CheckTokSymbol("["))
   {
     return ParseArrayLit();
   }
@@ -2746,7 +3058,7 @@ OExpr * ODqCompParser::ParseExprPrimary()
     {
       // check for floating point: 0.123, 2.1e-5, 1.234E6, 0.
       char c = *scf->curp;
-      if (('.' == c) or ('e' == c) or ('E' == c)) // convert to floating point
+      if ((('.' == c) and not scf->CheckTokSymbol("..", false)) or ('e' == c) or ('E' == c)) // convert to floating point
       {
         double fpval = intval;
         if (not scf->ReadFloatFracExp(fpval))
@@ -2782,25 +3094,25 @@ OExpr * ODqCompParser::ParseExprPrimary()
     }
   }
 
-  if (scf->CheckSymbol("true"))
+  if (scf->CheckTokKeyword(KW_TRUE))
   {
     result = new OBoolLit(true);
     return result;
   }
 
-  if (scf->CheckSymbol("false"))
+  if (scf->CheckTokKeyword(KW_FALSE))
   {
     result = new OBoolLit(false);
     return result;
   }
 
-  if (scf->CheckSymbol("null"))
+  if (scf->CheckTokKeyword(KW_NULL))
   {
     result = new ONullLit();
     return result;
   }
 
-  if (scf->CheckSymbol("@"))
+  if (scf->CheckTokSymbol("@"))
   {
     OScPosition scpos_ns = scf->prevpos;
     OValSym * vs = ResolveNamespaceValSym();
@@ -2810,6 +3122,7 @@ OExpr * ODqCompParser::ParseExprPrimary()
     }
 
     result = new OLValueVar(vs);
+    CheckReadnoneRead(vs, &scpos_ns);
     if (vs->kind != VSK_FUNCTION and not vs->initialized)
     {
       if (vs->IsRefLike() && (FPM_REFOUT == vs->param_mode))
@@ -2852,27 +3165,33 @@ OExpr * ODqCompParser::ParseExprPrimary()
 
   // builtin specials
 
-  if ("len" == sid)
+  switch (KeywordOfId(scf->previdentid))  // interned by the ReadIdentifier()
   {
-    return ParseBuiltinLen();
-  }
+    case KW_LEN:          return ParseBuiltinLen();
+    case KW_IIF:          return ParseBuiltinIif();
+    case KW_SIZEOF:       return ParseBuiltinSizeof();
 
-  if ("iif" == sid)
-  {
-    return ParseBuiltinIif();
-  }
+    case KW_ROUND:        return ParseBuiltinFloatRound(RNDMODE_ROUND);
+    case KW_CEIL:         return ParseBuiltinFloatRound(RNDMODE_CEIL);
+    case KW_FLOOR:        return ParseBuiltinFloatRound(RNDMODE_FLOOR);
 
-  if ("sizeof" == sid)
-  {
-    return ParseBuiltinSizeof();
-  }
+    // SIMD vector builtins
+    case KW_VLOAD:        return ParseBuiltinVecLoad();
+    case KW_VSTORE:       return ParseBuiltinVecStore();
+    case KW_VSHUFFLE:     return ParseBuiltinVecShuffle();
+    case KW_VSELECT:      return ParseBuiltinVecSelect();
+    case KW_VREDUCE_ADD:  return ParseBuiltinVecReduce(VECRED_ADD);
+    case KW_VREDUCE_MUL:  return ParseBuiltinVecReduce(VECRED_MUL);
+    case KW_VREDUCE_MIN:  return ParseBuiltinVecReduce(VECRED_MIN);
+    case KW_VREDUCE_MAX:  return ParseBuiltinVecReduce(VECRED_MAX);
+    case KW_VANY:         return ParseBuiltinVecReduce(VECRED_ANY);
+    case KW_VALL:         return ParseBuiltinVecReduce(VECRED_ALL);
 
-  if ("round" == sid)  return ParseBuiltinFloatRound(RNDMODE_ROUND);
-  if ("ceil"  == sid)  return ParseBuiltinFloatRound(RNDMODE_CEIL);
-  if ("floor" == sid)  return ParseBuiltinFloatRound(RNDMODE_FLOOR);
+    default:              break;
+  }
 
   OScope * found_scope = nullptr;
-  OValSym * vs = curscope->FindValSym(sid, &found_scope);
+  OValSym * vs = curscope->FindValSym(scf->previdentid, &found_scope);  // interned by the ReadIdentifier()
   if (!vs)
   {
     Error(DQERR_VS_UNKNOWN, sid);
@@ -2883,6 +3202,7 @@ OExpr * ODqCompParser::ParseExprPrimary()
   if (!result)
   {
     result = new OLValueVar(vs);
+    CheckReadnoneRead(vs, &scpos_sid);
   }
   if (vs->kind != VSK_FUNCTION and not vs->initialized)
   {
@@ -2911,7 +3231,7 @@ OValSym * ODqCompParser::ResolveNamespaceValSym()
   string nsname;
   string symname;
 
-  if (scf->CheckSymbol("."))
+  if (scf->CheckTokSymbol("."))
   {
     nsname = ".";
   }
@@ -2921,7 +3241,7 @@ OValSym * ODqCompParser::ResolveNamespaceValSym()
     return nullptr;
   }
 
-  if ("." != nsname && !scf->CheckSymbol("."))
+  if ("." != nsname && !scf->CheckTokSymbol("."))
   {
     Error(DQERR_DOT_MISSING_AFTER_NS_NAME);
     return nullptr;
@@ -2958,14 +3278,14 @@ OExpr * ODqCompParser::ParseArrayLit()
   while (not scf->Eof())
   {
     scf->SkipWhite();
-    if (scf->CheckSymbol("]"))
+    if (scf->CheckTokSymbol("]"))
     {
       break;
     }
 
     if (elems.size() > 0)
     {
-      if (not scf->CheckSymbol(","))
+      if (not scf->CheckTokSymbol(","))
       {
         Error(DQERR_MISSING_COMMA_IN, "array literal");
       }
@@ -3002,12 +3322,12 @@ bool ODqCompParser::ParseRawCallArguments(const string & callname, vector<TRawCa
   while (true)
   {
     scf->SkipWhite();
-    if (scf->CheckSymbol(")"))
+    if (scf->CheckTokSymbol(")"))
     {
       break;
     }
 
-    if ((pcnt > 0) and not scf->CheckSymbol(","))
+    if ((pcnt > 0) and not scf->CheckTokSymbol(","))
     {
       Error(DQERR_FUNC_ARGS_LIST, "\",\" or \")\" is missing at function \"$1\"call arguments", callname);
       FreeRawCallArguments(rargs);
@@ -3187,17 +3507,27 @@ bool ODqCompParser::BindCallArguments(const string & callname, OTypeFunc * tfunc
           break;
         }
 
-        if (!OTypeFunc::SameRefBindingType(fparam->ptype, argexpr->ptype))
+        // a writable reference argument lets the callee write it,
+        // the receiver is left to the callee check of the CheckPureFuncCall()
+        if (((FPM_REF == fparam->mode) or (FPM_REFOUT == fparam->mode)) and ("__this" != fparam->name)
+            and !CheckPureFuncWrite(arglval))
         {
-          string type_text = format("{} = {}", fparam->ptype->name, argexpr->ptype->name);
-          ErrorTxt(DQERR_FUNC_ARG_REF_TYPE,
-                   format("Reference argument {} type mismatch for function \"{}\": {}", pcnt + 1, callname, type_text));
           OExpr::DeleteTree(argexpr);
           bok = false;
           break;
         }
 
-        if (!rawarg.init_diags.empty() && ((FPM_REF == fparam->mode) || (FPM_REFIN == fparam->mode) || (FPM_REFNULL == fparam->mode)))
+        if (!OTypeFunc::SameRefBindingType(fparam->ptype, argexpr->ptype))
+        {
+          string type_text = format("{} = {}", fparam->ptype->name, argexpr->ptype->name);
+          ErrorTxt(DQERR_FUNC_ARG_REF_TYPE,
+                   format("Reference argument {} type mismatch for function \"{}\": {}", pcnt + 1, callname, type_text));
+          OExpr::DeleteTree(argexpr);
+          bok = false;
+          break;
+        }
+
+        if (!rawarg.init_diags.empty() && ((FPM_REF == fparam->mode) || (FPM_REFIN == fparam->mode) || (FPM_REFNULL == fparam->mode)))
         {
           OValSym * uninitvs = rawarg.init_diags[0].valsym;
           Error(DQERR_FUNC_ARG_REF_UNINIT, uninitvs->name);
@@ -3257,6 +3587,8 @@ OExpr * ODqCompParser::ParseExprFuncCall(OValSymFunc * vsfunc)
     return ParseExprMethodCall(vsfunc, nullptr);
   }
 
+  CheckPureFuncCall(vsfunc, vsfunc->name);
+
   OCallExpr * result = new OCallExpr(vsfunc);
   if (!ParseCallArguments(vsfunc->name, static_cast<OTypeFunc *>(vsfunc->ptype), result->args))
   {
@@ -3276,6 +3608,8 @@ OExpr * ODqCompParser::ParseExprMethodCall(OValSymFunc * vsfunc, OLValueExpr * r
     return nullptr;
   }
 
+  CheckPureFuncCall(vsfunc, vsfunc->name);
+
   vector<TRawCallArg> rawargs;
 
   TRawCallArg thisarg;
@@ -3422,6 +3756,8 @@ OExpr * ODqCompParser::ParseExprOverloadCallWithRawArgs(OValSymOverloadSet * ovs
     return nullptr;
   }
 
+  CheckPureFuncCall(best_func, ovset->name);
+
   OCallExpr * result = new OCallExpr(best_func);
   if (!BindCallArguments(ovset->name, static_cast<OTypeFunc *>(best_func->ptype), rawargs, result->args))
   {
@@ -3436,8 +3772,11 @@ OExpr * ODqCompParser::ParseExprOverloadCallWithRawArgs(OValSymOverloadSet * ovs
 
 OExpr * ODqCompParser::ParseExprIndirectCall(OExpr * callee, OTypeFuncRef * calltype)
 {
-  OIndirectCallExpr * result = new OIndirectCallExpr(callee, calltype);
   string callname = (calltype ? calltype->name : string("funcref"));
+  auto * calleevar = dynamic_cast<OLValueVar *>(callee);
+  CheckPureFuncCall(nullptr, (calleevar ? calleevar->pvalsym->name : callname));  // the function behind the reference is unknown
+
+  OIndirectCallExpr * result = new OIndirectCallExpr(callee, calltype);
   if (!ParseCallArguments(callname, (calltype ? calltype->functype : nullptr), result->args))
   {
     delete result;
@@ -3452,11 +3791,11 @@ OExpr * ODqCompParser::ParseBuiltinIif()
   auto recover_iif_tail = [this]()
   {
     scf->ReadTo(");");
-    scf->CheckSymbol(")");
+    scf->CheckTokSymbol(")");
   };
 
   scf->SkipWhite();
-  if (not scf->CheckSymbol("("))
+  if (not scf->CheckTokSymbol("("))
   {
     Error(DQERR_MISSING_OPEN_PAREN_AFTER, "iif");
     return nullptr;
@@ -3479,7 +3818,7 @@ OExpr * ODqCompParser::ParseBuiltinIif()
   }
 
   scf->SkipWhite();
-  if (not scf->CheckSymbol(","))
+  if (not scf->CheckTokSymbol(","))
   {
     Error(DQERR_FUNC_ARGS_TOO_FEW, "1", "iif", "3");
     recover_iif_tail();
@@ -3496,7 +3835,7 @@ OExpr * ODqCompParser::ParseBuiltinIif()
   }
 
   scf->SkipWhite();
-  if (not scf->CheckSymbol(","))
+  if (not scf->CheckTokSymbol(","))
   {
     Error(DQERR_FUNC_ARGS_TOO_FEW, "2", "iif", "3");
     recover_iif_tail();
@@ -3516,7 +3855,7 @@ OExpr * ODqCompParser::ParseBuiltinIif()
   }
 
   scf->SkipWhite();
-  if (scf->CheckSymbol(","))
+  if (scf->CheckTokSymbol(","))
   {
     Error(DQERR_FUNC_ARGS_TOO_MANY, "iif", "3");
     recover_iif_tail();
@@ -3526,7 +3865,7 @@ OExpr * ODqCompParser::ParseBuiltinIif()
     return nullptr;
   }
 
-  if (not scf->CheckSymbol(")"))
+  if (not scf->CheckTokSymbol(")"))
   {
     Error(DQERR_MISSING_CLOSE_PAREN_FOR, "iif");
     recover_iif_tail();
@@ -3551,7 +3890,7 @@ OExpr * ODqCompParser::ParseBuiltinIif()
 OExpr * ODqCompParser::ParseBuiltinFloatRound(ERoundMode amode)
 {
   scf->SkipWhite();
-  if (not scf->CheckSymbol("("))
+  if (not scf->CheckTokSymbol("("))
   {
     Error(DQERR_MISSING_OPEN_PAREN_AFTER, GetRoundModeName(amode));
     return nullptr;
@@ -3566,7 +3905,7 @@ OExpr * ODqCompParser::ParseBuiltinFloatRound(ERoundMode amode)
     return nullptr;
   }
   scf->SkipWhite();
-  if (not scf->CheckSymbol(")"))
+  if (not scf->CheckTokSymbol(")"))
   {
     Error(DQERR_MISSING_CLOSE_PAREN_FOR, GetRoundModeName(amode));
     delete argexpr;
@@ -3575,10 +3914,328 @@ OExpr * ODqCompParser::ParseBuiltinFloatRound(ERoundMode amode)
   return new OFloatRoundExpr(amode, argexpr);
 }
 
+// Parses a builtin function argument followed by "," or by the closing ")" when alast
+OExpr * ODqCompParser::ParseVecBuiltinArg(const string & afuncname, bool alast)
+{
+  OExpr * argexpr = ParseExpression();
+  if (!argexpr)  return nullptr;
+
+  scf->SkipWhite();
+  if (alast and not scf->CheckTokSymbol(")"))
+  {
+    Error(DQERR_MISSING_CLOSE_PAREN_FOR, afuncname);
+    delete argexpr;
+    return nullptr;
+  }
+  if (not alast and not scf->CheckTokSymbol(","))
+  {
+    ErrorTxt(DQERR_FUNC_ARGS_LIST, format("\",\" expected in the \"{}\" argument list", afuncname));
+    delete argexpr;
+    return nullptr;
+  }
+  return argexpr;
+}
+
+// The vload() / vstore() memory operand: an array, slice or pointer element like arr[i] or p[i]^
+OLValueExpr * ODqCompParser::ParseVecElemRef(const string & afuncname, OType * aelemtype)
+{
+  OExpr * refexpr = ParseExpression();
+  if (!refexpr)  return nullptr;
+
+  if (!dynamic_cast<OLValueIndex *>(refexpr) and !dynamic_cast<OLValueDeref *>(refexpr))
+  {
+    Error(DQERR_VEC_ELEM_REF, afuncname);
+    delete refexpr;
+    return nullptr;
+  }
+
+  if (aelemtype and (refexpr->ResolvedType() != aelemtype->ResolveAlias()))
+  {
+    Error(DQERR_ARR_ELEM_TYPE_MISM, aelemtype->name, refexpr->ptype->name);
+    delete refexpr;
+    return nullptr;
+  }
+
+  return static_cast<OLValueExpr *>(refexpr);
+}
+
+OExpr * ODqCompParser::ParseBuiltinVecReduce(EVecReduceOp aop)
+{
+  string funcname = GetVecReduceName(aop);
+  scf->SkipWhite();
+  if (not scf->CheckTokSymbol("("))
+  {
+    Error(DQERR_MISSING_OPEN_PAREN_AFTER, funcname);
+    return nullptr;
+  }
+
+  OExpr * argexpr = ParseVecBuiltinArg(funcname, true);
+  if (!argexpr)  return nullptr;
+
+  if (!argexpr->IsVector())
+  {
+    Error(DQERR_VEC_TYPE_EXPECTED, funcname, (argexpr->ptype ? argexpr->ptype->name : "void"));
+    delete argexpr;
+    return nullptr;
+  }
+
+  // vany() and vall() reduce masks, the others numeric vectors
+  bool maskop = ((VECRED_ANY == aop) or (VECRED_ALL == aop));
+  if (maskop != static_cast<OTypeVector *>(argexpr->ResolvedType())->IsMask())
+  {
+    Error(DQERR_OP_INVALID_FOR, funcname, argexpr->ptype->name);
+    delete argexpr;
+    return nullptr;
+  }
+
+  return new OVecReduceExpr(aop, argexpr);
+}
+
+OExpr * ODqCompParser::ParseBuiltinVecShuffle()
+{
+  scf->SkipWhite();
+  if (not scf->CheckTokSymbol("("))
+  {
+    Error(DQERR_MISSING_OPEN_PAREN_AFTER, "vshuffle");
+    return nullptr;
+  }
+
+  OExpr * src1 = ParseVecBuiltinArg("vshuffle", false);
+  if (!src1)  return nullptr;
+  if (!src1->IsVector())
+  {
+    Error(DQERR_VEC_TYPE_EXPECTED, "vshuffle", (src1->ptype ? src1->ptype->name : "void"));
+    delete src1;
+    return nullptr;
+  }
+
+  // the second source is optional: vshuffle(a, [...]) or vshuffle(a, b, [...])
+  OExpr * src2 = nullptr;
+  OExpr * idxexpr = ParseExpression();
+  if (!idxexpr)
+  {
+    delete src1;
+    return nullptr;
+  }
+  if (!dynamic_cast<OArrayLit *>(idxexpr))
+  {
+    src2 = idxexpr;
+    scf->SkipWhite();
+    if (not scf->CheckTokSymbol(","))
+    {
+      ErrorTxt(DQERR_FUNC_ARGS_LIST, "\",\" expected in the \"vshuffle\" argument list");
+      FreeLeftRight(src1, src2);
+      return nullptr;
+    }
+    idxexpr = ParseExpression();
+    if (!idxexpr)
+    {
+      FreeLeftRight(src1, src2);
+      return nullptr;
+    }
+  }
+
+  scf->SkipWhite();
+  if (not scf->CheckTokSymbol(")"))
+  {
+    Error(DQERR_MISSING_CLOSE_PAREN_FOR, "vshuffle");
+    FreeLeftRight(src1, src2);
+    delete idxexpr;
+    return nullptr;
+  }
+
+  if (src2 and (src2->ResolvedType() != src1->ResolvedType()))
+  {
+    Error(DQERR_TYPEMISM_FOR_OP, src1->ptype->name, "vshuffle", (src2->ptype ? src2->ptype->name : "void"));
+    FreeLeftRight(src1, src2);
+    delete idxexpr;
+    return nullptr;
+  }
+
+  auto * idxlit = dynamic_cast<OArrayLit *>(idxexpr);
+  if (!idxlit or idxlit->elements.empty())
+  {
+    ErrorTxt(DQERR_FUNC_ARGS_LIST, "vshuffle() lane index list expected, example: [3, 2, 1, 0]");
+    FreeLeftRight(src1, src2);
+    delete idxexpr;
+    return nullptr;
+  }
+
+  int maxidx = static_cast<OTypeVector *>(src1->ResolvedType())->lanes * (src2 ? 2 : 1) - 1;
+  vector<int> indices;
+  for (OExpr * elem : idxlit->elements)
+  {
+    OValueInt idxval(g_builtins->type_int, 0);
+    bool is_const = ((elem->ResolvedType() and (TK_INT == elem->ResolvedType()->kind))
+                     and idxval.CalculateConstant(elem, false));
+    if (not is_const or (idxval.value < 0) or (idxval.value > maxidx))
+    {
+      Error(DQERR_VEC_SHUFFLE_INDEX, (is_const ? to_string(idxval.value) : string("?")), to_string(maxidx));
+      FreeLeftRight(src1, src2);
+      delete idxexpr;
+      return nullptr;
+    }
+    indices.push_back(int(idxval.value));
+  }
+  delete idxexpr;
+
+  return new OVecShuffleExpr(src1, src2, indices);
+}
+
+OExpr * ODqCompParser::ParseBuiltinVecSelect()
+{
+  scf->SkipWhite();
+  if (not scf->CheckTokSymbol("("))
+  {
+    Error(DQERR_MISSING_OPEN_PAREN_AFTER, "vselect");
+    return nullptr;
+  }
+
+  OExpr * maskexpr = ParseVecBuiltinArg("vselect", false);
+  if (!maskexpr)  return nullptr;
+  if (!maskexpr->IsVector() or !static_cast<OTypeVector *>(maskexpr->ResolvedType())->IsMask())
+  {
+    Error(DQERR_VEC_TYPE_EXPECTED, "vselect", (maskexpr->ptype ? maskexpr->ptype->name : "void"));
+    delete maskexpr;
+    return nullptr;
+  }
+
+  OExpr * trueexpr = ParseVecBuiltinArg("vselect", false);
+  if (!trueexpr)
+  {
+    delete maskexpr;
+    return nullptr;
+  }
+
+  OExpr * falseexpr = ParseVecBuiltinArg("vselect", true);
+  if (!falseexpr)
+  {
+    FreeLeftRight(maskexpr, trueexpr);
+    return nullptr;
+  }
+
+  // the scalar value operands are broadcasted like at the binary operators
+  OTypeVector * masktype = static_cast<OTypeVector *>(maskexpr->ResolvedType());
+  OType * resulttype = nullptr;
+  if (not ResolveIifType(&trueexpr, &falseexpr, &resulttype) or (TK_VECTOR != resulttype->ResolveAlias()->kind))
+  {
+    if (resulttype)
+    {
+      Error(DQERR_VEC_TYPE_EXPECTED, "vselect", resulttype->name);
+    }
+    FreeLeftRight(maskexpr, trueexpr);
+    delete falseexpr;
+    return nullptr;
+  }
+
+  if (static_cast<OTypeVector *>(resulttype->ResolveAlias())->lanes != masktype->lanes)
+  {
+    Error(DQERR_VEC_LANES_MISM, masktype->name, resulttype->name);
+    FreeLeftRight(maskexpr, trueexpr);
+    delete falseexpr;
+    return nullptr;
+  }
+
+  return new OVecSelectExpr(maskexpr, trueexpr, falseexpr);
+}
+
+OExpr * ODqCompParser::ParseBuiltinVecLoad()
+{
+  scf->SkipWhite();
+  if (not scf->CheckTokSymbol("("))
+  {
+    Error(DQERR_MISSING_OPEN_PAREN_AFTER, "vload");
+    return nullptr;
+  }
+
+  scf->SkipWhite();
+  OType * vectype = ParseTypeSpec(true);
+  if (!vectype)  return nullptr;
+  OTypeVector * vecrtype = dynamic_cast<OTypeVector *>(vectype->ResolveAlias());
+  if (!vecrtype or vecrtype->IsMask())
+  {
+    Error(DQERR_VEC_TYPE_EXPECTED, "vload", vectype->name);
+    return nullptr;
+  }
+
+  scf->SkipWhite();
+  if (not scf->CheckTokSymbol(","))
+  {
+    ErrorTxt(DQERR_FUNC_ARGS_LIST, "\",\" expected in the \"vload\" argument list");
+    return nullptr;
+  }
+
+  OLValueExpr * elemref = ParseVecElemRef("vload", vecrtype->elemtype);
+  if (!elemref)  return nullptr;
+
+  scf->SkipWhite();
+  if (not scf->CheckTokSymbol(")"))
+  {
+    Error(DQERR_MISSING_CLOSE_PAREN_FOR, "vload");
+    delete elemref;
+    return nullptr;
+  }
+
+  return new OVecLoadExpr(vecrtype, elemref);
+}
+
+OExpr * ODqCompParser::ParseBuiltinVecStore()
+{
+  scf->SkipWhite();
+  if (not scf->CheckTokSymbol("("))
+  {
+    Error(DQERR_MISSING_OPEN_PAREN_AFTER, "vstore");
+    return nullptr;
+  }
+
+  OLValueExpr * elemref = ParseVecElemRef("vstore", nullptr);
+  if (!elemref)  return nullptr;
+
+  scf->SkipWhite();
+  if (not scf->CheckTokSymbol(","))
+  {
+    ErrorTxt(DQERR_FUNC_ARGS_LIST, "\",\" expected in the \"vstore\" argument list");
+    delete elemref;
+    return nullptr;
+  }
+
+  OExpr * valueexpr = ParseVecBuiltinArg("vstore", true);
+  if (!valueexpr)
+  {
+    delete elemref;
+    return nullptr;
+  }
+
+  OTypeVector * vectype = (valueexpr->IsVector() ? static_cast<OTypeVector *>(valueexpr->ResolvedType()) : nullptr);
+  if (!vectype or vectype->IsMask())
+  {
+    Error(DQERR_VEC_TYPE_EXPECTED, "vstore", (valueexpr->ptype ? valueexpr->ptype->name : "void"));
+    FreeLeftRight(elemref, valueexpr);
+    return nullptr;
+  }
+
+  if (vectype->elemtype->ResolveAlias() != elemref->ResolvedType())
+  {
+    Error(DQERR_ARR_ELEM_TYPE_MISM, vectype->elemtype->name, elemref->ptype->name);
+    FreeLeftRight(elemref, valueexpr);
+    return nullptr;
+  }
+
+  OValSym * rootvalsym = GetAssignRootValSym(elemref);
+  if (rootvalsym and (VSK_CONST == rootvalsym->kind))
+  {
+    Error(DQERR_TYPE_ASSIGN_TO_CONST, rootvalsym->name);
+    FreeLeftRight(elemref, valueexpr);
+    return nullptr;
+  }
+
+  return new OVecStoreExpr(elemref, valueexpr);
+}
+
 OExpr * ODqCompParser::ParseBuiltinLen()
 {
   scf->SkipWhite();
-  if (not scf->CheckSymbol("("))
+  if (not scf->CheckTokSymbol("("))
   {
     Error(DQERR_MISSING_OPEN_PAREN_AFTER, "len");
     return nullptr;
@@ -3597,7 +4254,7 @@ OExpr * ODqCompParser::ParseBuiltinLen()
     return nullptr;
   }
   scf->SkipWhite();
-  if (not scf->CheckSymbol(")"))
+  if (not scf->CheckTokSymbol(")"))
   {
     Error(DQERR_MISSING_CLOSE_PAREN_FOR, "len");
     return nullptr;
@@ -3613,6 +4270,10 @@ OExpr * ODqCompParser::ParseBuiltinLen()
   }
   else if (TK_STRING == lenvs->ptype->kind)
   {
+    if (0 == static_cast<OTypeCString *>(lenvs->ptype)->maxlen)
+    {
+      CheckReadnoneDeref("an unsized cstring");
+    }
     return new OCStringLenExpr(lenvs);
   }
   else
@@ -3625,7 +4286,7 @@ OExpr * ODqCompParser::ParseBuiltinLen()
 OExpr * ODqCompParser::ParseBuiltinSizeof()
 {
   scf->SkipWhite();
-  if (not scf->CheckSymbol("("))
+  if (not scf->CheckTokSymbol("("))
   {
     Error(DQERR_MISSING_OPEN_PAREN_AFTER, "sizeof");
     return nullptr;
@@ -3636,7 +4297,7 @@ OExpr * ODqCompParser::ParseBuiltinSizeof()
   OScPosition argpos;
   scf->SaveCurPos(argpos);
 
-  if (scf->CheckSymbol("^", false))
+  if (scf->CheckTokSymbol("^", false))
   {
     sizetype = ParseTypeSpec();
   }
@@ -3674,7 +4335,7 @@ OExpr * ODqCompParser::ParseBuiltinSizeof()
   }
 
   scf->SkipWhite();
-  if (not scf->CheckSymbol(")"))
+  if (not scf->CheckTokSymbol(")"))
   {
     Error(DQERR_MISSING_CLOSE_PAREN_FOR, "sizeof");
     return nullptr;
@@ -3693,19 +4354,38 @@ EBinOp ODqCompParser::ParseAssignOp()
 {
   scf->SkipWhite();
 
-  if      (scf->CheckSymbol("+="))      return BINOP_ADD;
-  else if (scf->CheckSymbol("-="))      return BINOP_SUB;
-  else if (scf->CheckSymbol("*="))      return BINOP_MUL;
-  else if (scf->CheckSymbol("/="))      return BINOP_DIV;
-  else if (scf->CheckSymbol("<<="))     return BINOP_ISHL;
-  else if (scf->CheckSymbol(">>="))     return BINOP_ISHR;
-  else if (scf->CheckSymbol("=IDIV="))  return BINOP_IDIV;
-  else if (scf->CheckSymbol("=IMOD="))  return BINOP_IMOD;
-  else if (scf->CheckSymbol("=AND="))   return BINOP_IAND;
-  else if (scf->CheckSymbol("=OR="))    return BINOP_IOR;
-  else if (scf->CheckSymbol("=XOR="))   return BINOP_IXOR;
-  else if (scf->CheckSymbol("="))       return BINOP_NONE;  // must come after =XXX=!, simple assign (ab)uses BINOP_NONE
-  return EBinOp(-1);  // not an assignment operator
+  if      (scf->CheckTokSymbol("+="))      return BINOP_ADD;
+  else if (scf->CheckTokSymbol("-="))      return BINOP_SUB;
+  else if (scf->CheckTokSymbol("*="))      return BINOP_MUL;
+  else if (scf->CheckTokSymbol("/="))      return BINOP_DIV;
+  else if (scf->CheckTokSymbol("<<="))     return BINOP_ISHL;
+  else if (scf->CheckTokSymbol(">>="))     return BINOP_ISHR;
+  else if (not scf->CheckTokSymbol("="))
+  {
+    return EBinOp(-1);  // not an assignment operator
+  }
+
+  // the integer operators are written without spaces: =IDIV=, =IMOD=, =AND=, =OR=, =XOR=
+  EBinOp op;
+  EKeyword kw = scf->CurKeyword();
+  switch (kw)
+  {
+    case KW_IDIV:     op = BINOP_IDIV;  break;
+    case KW_IMOD:     op = BINOP_IMOD;  break;
+    case KW_BIN_AND:  op = BINOP_IAND;  break;
+    case KW_BIN_OR:   op = BINOP_IOR;   break;
+    case KW_BIN_XOR:  op = BINOP_IXOR;  break;
+    default:          return BINOP_NONE;  // simple assign (ab)uses BINOP_NONE
+  }
+
+  OScPosition oppos;
+  scf->SaveCurPos(oppos);
+  if (scf->CheckTokKeyword(kw) and scf->CheckTokSymbol("="))
+  {
+    return op;
+  }
+  scf->SetCurPos(oppos);  // not closed, the "=" was a simple assignment
+  return BINOP_NONE;
 }
 
 void ODqCompParser::VarInitError(OLValueVar * varexpr, OValSym * valsym, OScPosition & scpos)
@@ -3796,6 +4476,158 @@ void ODqCompParser::EmitFilteredAssignVarInitDiags(OLValueExpr * leftexpr, EBinO
   suppressed_varinit_diags.clear();
 }
 
+static bool IsInPlaceContainer(OType * acontainertype)
+{
+  OType * ctype = acontainertype->ResolveAlias();
+  if (TK_STRING == ctype->kind)
+  {
+    return (static_cast<OTypeCString *>(ctype)->maxlen > 0);
+  }
+  return ((TK_ARRAY == ctype->kind) or (TK_VECTOR == ctype->kind));
+}
+
+bool ODqCompParser::CheckPureFuncWrite(OLValueExpr * leftexpr)
+{
+  if (!curvsfunc or !curblock or !(curvsfunc->attr_fnhints & (ATTF_PURE | ATTF_READNONE)))
+  {
+    return true;
+  }
+
+  // walk down to the written storage, the arrays, vectors and cstring[N] are stored in place,
+  // the rest (dereference, slice and unsized cstring index) goes through a pointer
+  OLValueExpr *    lval = leftexpr;
+  OLValueMember *  topmember = nullptr;
+  while (true)
+  {
+    if (auto * memberref = dynamic_cast<OLValueMember *>(lval))
+    {
+      topmember = memberref;
+      lval = memberref->base;
+    }
+    else if (auto * indexref = dynamic_cast<OLValueIndex *>(lval);
+             indexref and IsInPlaceContainer(indexref->containertype))
+    {
+      lval = indexref->base;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  string   attrname = AttrName((curvsfunc->attr_fnhints & ATTF_PURE) ? ATTF_PURE : ATTF_READNONE);
+  auto *   varref = dynamic_cast<OLValueVar *>(lval);
+  if (!varref)
+  {
+    if (!(curvsfunc->attr_fnhints & ATTF_READNONE))  // already reported by the CheckReadnoneDeref()
+    {
+      Error(DQERR_ATTR_PURE_WRITE, attrname, "through a pointer");
+    }
+    return false;
+  }
+
+  OValSym * vs = varref->pvalsym;
+  if (vs == curvsfunc->receiver_arg)
+  {
+    OCompoundType * ctype = curvsfunc->owner_compound_type;
+    if (topmember and (topmember->memberindex < ctype->member_order.size()))
+    {
+      Error(DQERR_ATTR_PURE_WRITE, attrname, format("the object field \"{}\"", ctype->member_order[topmember->memberindex]->name));
+    }
+    else
+    {
+      Error(DQERR_ATTR_PURE_WRITE, attrname, "the object fields");  // whole object, or a non-pure method call
+    }
+    return false;
+  }
+  if (vs->IsRefLike())
+  {
+    // the writable reference parameters are already rejected at the function declaration
+    if (VSK_PARAMETER == vs->kind)
+    {
+      return true;
+    }
+    Error(DQERR_ATTR_PURE_WRITE, attrname, format("the reference target \"{}\"", vs->name));
+    return false;
+  }
+
+  if (IsCurFuncLocal(vs))
+  {
+    return true;
+  }
+
+  if (!(curvsfunc->attr_fnhints & ATTF_READNONE))  // already reported as read by the CheckReadnoneRead()
+  {
+    Error(DQERR_ATTR_PURE_WRITE, attrname, format("the global variable \"{}\"", vs->name));
+  }
+  return false;
+}
+
+bool ODqCompParser::IsCurFuncLocal(OValSym * avalsym)
+{
+  // the locals are defined in the block scopes of the function body
+  for (OScope * scope = curblock->scope; scope; scope = scope->parent_scope)
+  {
+    if (scope->valsyms.Find(avalsym->nameid) == avalsym)
+    {
+      return true;
+    }
+    if (scope == curvsfunc->body->scope)
+    {
+      break;
+    }
+  }
+  return false;
+}
+
+void ODqCompParser::CheckReadnoneRead(OValSym * avalsym, OScPosition * ascpos)
+{
+  if (!curvsfunc or !curblock or !(curvsfunc->attr_fnhints & ATTF_READNONE))
+  {
+    return;
+  }
+
+  // the parameters are values (the reference parameters are rejected at the declaration),
+  // the object fields are not reachable, the readnone methods are rejected
+  if ((VSK_VARIABLE == avalsym->kind) and !IsCurFuncLocal(avalsym))
+  {
+    Error(DQERR_ATTR_READNONE_READ, avalsym->name, ascpos);
+  }
+}
+
+void ODqCompParser::CheckReadnoneDeref(const string & athrough)
+{
+  if (!curvsfunc or !curblock or !(curvsfunc->attr_fnhints & ATTF_READNONE))
+  {
+    return;
+  }
+
+  // the target can be anywhere (the reference parameters are rejected at the declaration), and
+  // memory(none) does not allow even the reads, the calls with different memory would be merged
+  Error(DQERR_ATTR_READNONE_DEREF, athrough);
+}
+
+bool ODqCompParser::CheckPureFuncCall(OValSymFunc * acallee, const string & acallname)
+{
+  if (!curvsfunc or !curblock or !(curvsfunc->attr_fnhints & (ATTF_PURE | ATTF_READNONE)))
+  {
+    return true;
+  }
+
+  // the memory effects of the callee must fit into the caller's ones, the [[external]] functions
+  // must be marked explicitly too
+  bool readnone = (curvsfunc->attr_fnhints & ATTF_READNONE);
+  uint64_t allowed = (readnone ? ATTF_READNONE : (ATTF_PURE | ATTF_READNONE));
+  if (acallee and (acallee->attr_fnhints & allowed))
+  {
+    return true;
+  }
+
+  Error(DQERR_ATTR_PURE_CALL, AttrName(readnone ? ATTF_READNONE : ATTF_PURE), acallname,
+        (readnone ? "[[readnone]]" : "[[pure]] or [[readnone]]"));
+  return false;
+}
+
 bool ODqCompParser::FinalizeStmtAssign(OLValueExpr * leftexpr, EBinOp op, OExpr * rightexpr)
 {
   if (!leftexpr || !rightexpr)
@@ -3822,6 +4654,13 @@ bool ODqCompParser::FinalizeStmtAssign(OLValueExpr * leftexpr, EBinOp op, OExpr
     return false;
   }
 
+  if (!CheckPureFuncWrite(leftexpr))
+  {
+    delete leftexpr;
+    delete rightexpr;
+    return false;
+  }
+
   OType * targettype = leftexpr->ptype;
 
   // Pointer arithmetic: p += int  or  p -= int
@@ -3848,6 +4687,14 @@ bool ODqCompParser::FinalizeStmtAssign(OLValueExpr * leftexpr, EBinOp op, OExpr
     return true;
   }
 
+  if ((BINOP_NONE != op) and leftexpr->IsVector()
+      and not CheckVectorBinOp(op, static_cast<OTypeVector *>(leftexpr->ResolvedType())))
+  {
+    delete leftexpr;
+    delete rightexpr;
+    return false;
+  }
+
   if (not CheckAssignType(targettype, &rightexpr, "Assignment"))
   {
     delete leftexpr;
@@ -3879,7 +4726,7 @@ void ODqCompParser::FinalizeStmtVoidCall(OExpr * callexpr)
 bool ODqCompParser::CheckStatementClose()
 {
   scf->SkipWhite();
-  if (not scf->CheckSymbol(";"))
+  if (not scf->CheckTokSymbol(";"))
   {
     StatementError(DQERR_MISSING_SEMICOLON_TO_CLOSE, "previous statement");
     return false;
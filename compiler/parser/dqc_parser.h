@@ -19,6 +19,7 @@
 #include "statements.h"
 #include "errorcodes.h"
 #include "dqc_ast.h"
+#include "dqc_keywords.h"
 
 using namespace std;
 
@@ -48,11 +49,17 @@ public: // root level items
   void ParseStmtRef();
 
 public: // statement blocks
-  void ReadStatementBlock(OStmtBlock * stblock, const string blockend, string * rendstr = nullptr);
+  void ReadStatementBlock(OStmtBlock * stblock, initializer_list<EKeyword> ablockends, EKeyword * rendkw = nullptr);  // rendkw = KW_NONE for "}"
 
   bool FinalizeStmtAssign(OLValueExpr * leftexpr, EBinOp op, OExpr * rightexpr);
+  bool CheckPureFuncWrite(OLValueExpr * leftexpr);  // the [[pure]] and [[readnone]] functions can write only their locals
+  bool CheckPureFuncCall(OValSymFunc * acallee, const string & acallname);  // and call only [[pure]] / [[readnone]] functions
+  void CheckReadnoneRead(OValSym * avalsym, OScPosition * ascpos);  // the [[readnone]] functions can not read globals
+  void CheckReadnoneDeref(const string & athrough);  // nor the memory through pointers, slices and cstring descriptors
+  bool IsCurFuncLocal(OValSym * avalsym);
   void ParseStmtReturn();
-  void ParseStmtWhile();
+  void ParseStmtWhile(OAttr * aloopattr);
+  void ParseStmtFor(OAttr * aloopattr);
   void ParseStmtIf();
   void FinalizeStmtVoidCall(OExpr * callexpr);
 
@@ -125,18 +132,26 @@ public: // expressions
   OExpr * ParseBuiltinLen();
   OExpr * ParseBuiltinSizeof();
   OExpr * ParseBuiltinFloatRound(ERoundMode amode);
+  OExpr * ParseBuiltinVecReduce(EVecReduceOp aop);
+  OExpr * ParseBuiltinVecShuffle();
+  OExpr * ParseBuiltinVecSelect();
+  OExpr * ParseBuiltinVecLoad();
+  OExpr * ParseBuiltinVecStore();
+  OExpr * ParseVecBuiltinArg(const string & afuncname, bool alast);
+  OLValueExpr * ParseVecElemRef(const string & afuncname, OType * aelemtype);
   OExpr * ParseArrayLit();
 
 protected:
-  struct BinOpEntry { const char * sym; EBinOp op; };
+  struct BinOpEntry { const char * sym; EKeyword kw; EBinOp op; };  // symbol or keyword operator
   OExpr * ParseBinOpLevel(OExpr * (ODqCompParser::*parse_next)(),
                           const BinOpEntry ops[], int nops);
   bool    ParseFunctionSignature(OTypeFunc * tfunc, bool atypespec, const string & aowner_name, bool aemit_errors = true);
 
   bool    ParseAttributeBlock();
   bool    ParseSingleAttribute(const string & attrname);
-  bool    ParseAttrIntArg(const string & attrname, int64_t & rvalue, bool positive_only = false);
+  bool    ParseAttrIntArg(const string & attrname, int64_t & rvalue, bool positive_only = false, const char * akeyname = nullptr);
   bool    ParseAttrStringArg(const string & attrname, string & rvalue);
+  bool    ParseAttrIdArg(const string & attrname, const vector<string> & aallowed, int & ridx);
   void    RecoverFailedFunctionDecl();
   bool    FinishFunctionDecl(OValSymFunc * vsfunc, OScope * decl_scope, OScope * body_parent_scope,
                              bool ahidden_decl, bool aallow_external, const string & aowner_desc);
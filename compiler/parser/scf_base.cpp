@@ -21,9 +21,16 @@
 #include <print>
 #include <format>
 #include <filesystem>
+#include <iterator>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "scf_base.h"
 #include "comp_options.h"
+#include "comp_timing.h"
 
 bool PCharUCCompare(char * * ReadPtr, int len, const char * checkstring)
 {
@@ -163,7 +170,7 @@ unsigned PCharHexToInt(char * ReadPtr, int len)
 
 //-------------------------------------------------------------------------
 
-void OScPosition::RecalcLineCol()  // this is slow
+void OScPosition::RecalcLineCol()
 {
   if (!scfile or (pos < scfile->pstart) or (pos > scfile->pend))
   {
@@ -172,35 +179,9 @@ void OScPosition::RecalcLineCol()  // this is slow
     return;
   }
 
-  char *  p       = pos;
-  char *  pstart  = scfile->pstart;
-
-  int     linenum = 1;
-  int     colnum  = 0;
-
-  // colum counting
-  while (p > pstart)
-  {
-    if ((*p == '\n') or (*p == '\r'))
-    {
-      break;
-    }
-    --p;
-    ++colnum;
-  }
-
-  // line counting
-  while (p > pstart)
-  {
-    if (*p == '\n')
-    {
-      ++linenum;
-    }
-    --p;
-  }
-
-  line = linenum;
-  col  = colnum;
+  int lineidx = scfile->LineIndex(pos);
+  line = lineidx + 1;
+  col  = (pos - scfile->LineStart(lineidx)) + 1;
 }
 
 string OScPosition::Format()
@@ -224,33 +205,71 @@ OScFile::OScFile()
 
 OScFile::~OScFile()
 {
-  body = "";
+  Unload();
 }
 
-bool OScFile::Load(const string aname, const string afullpath)
+int OScFile::LineIndex(const char * apos)
 {
-  name = aname;
-  fullpath = afullpath;
+  // the last line start which is not after the position
+  int32_t offs = apos - pstart;
+  auto it = upper_bound(linestarts.begin(), linestarts.end(), offs);
+  return max(0, int(it - linestarts.begin()) - 1);
+}
+
+int OScFile::TokenIndex(uint32_t aoffset)
+{
+  // the tokens do not overlap, so their ends are ordered too
+  auto it = upper_bound(tokens.begin(), tokens.end(), aoffset,
+                        [](uint32_t aoffs, const SScToken & tok) { return aoffs < tok.offset + tok.length; });
+  return min(int(it - tokens.begin()), int(tokens.size()) - 1);
+}
+
+void OScFile::BuildLineIndex()
+{
+  linestarts.clear();
+  linestarts.push_back(0);
+  for (char * p = pstart; p < pend; ++p)
+  {
+    if ('\n' == *p)
+    {
+      linestarts.push_back((p + 1) - pstart);
+    }
+  }
+}
+
+void OScFile::Unload()
+{
+  if (mapped)
+  {
+    munmap(pstart, length);
+    mapped = false;
+  }
   body = "";
   length = -1;
   pstart = nullptr;
   pend = nullptr;
+  linestarts.clear();
+  tokens.clear();
+  tokenized = false;
+}
 
-  ifstream f(fullpath, ios::binary | ios::ate);
-  if (!f)
+bool OScFile::Load(const string aname, const string afullpath)
+{
+  Unload();
+  name = aname;
+  fullpath = afullpath;
+
+  TTimeClock::time_point t0 = TTimeClock::now();
+
+  // the mapping falls back to copying for pipes, stdin and other special files
+  if (!(g_opt.mmap_sources and LoadMapped()) and !LoadCopy())
   {
     return false;
   }
 
-  length = f.tellg();
-  body.resize(length);
-  if (length > 0)
-  {
-    f.seekg(0);
-    f.read(body.data(), length);
-    pstart = body.data();
-    pend = pstart + length;
-  }
+  BuildLineIndex();
+
+  g_timer.AddSourceLoad(length, mapped, chrono::duration<double>(TTimeClock::now() - t0).count());
 
   if (g_opt.dbg_info)
   {
@@ -260,6 +279,55 @@ bool OScFile::Load(const string aname, const string afullpath)
   return true;
 }
 
+bool OScFile::LoadMapped()
+{
+  int fd = open(fullpath.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  struct stat st;
+  if ((fstat(fd, &st) != 0) or !S_ISREG(st.st_mode) or (st.st_size <= 0) or (st.st_size > INT32_MAX)
+      or (0 == (st.st_size % sysconf(_SC_PAGESIZE))))  // the parser may peek one character after the end
+  {
+    close(fd);
+    return false;
+  }
+
+  void * p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // the mapping remains valid
+  if (MAP_FAILED == p)
+  {
+    return false;
+  }
+
+  length = st.st_size;
+  pstart = (char *)p;
+  pend = pstart + length;
+  mapped = true;
+  return true;
+}
+
+bool OScFile::LoadCopy()
+{
+  ifstream f(fullpath, ios::binary);
+  if (!f)
+  {
+    return false;
+  }
+
+  // read until the end, the size of a pipe is not known in advance
+  body.assign(istreambuf_iterator<char>(f), istreambuf_iterator<char>());
+  length = body.size();
+  if (length > 0)
+  {
+    pstart = body.data();
+    pend = pstart + length;
+  }
+  return true;
+}
+
 string ExtractFilePath(const string & full_path)
 {
   filesystem::path path_obj(full_path);
@@ -297,6 +365,8 @@ void OScFeederBase::Reset()
   clstart = nullptr;
   curline = 1;
   curcol  = 1;
+  tokfile = nullptr;
+  curtok  = 0;
 }
 
 string OScFeederBase::PrevStr()
@@ -311,6 +381,7 @@ void OScFeederBase::SaveCurPos(OScPosition & rpos)
   rpos.pos    = curp;
   rpos.line   = curline;
   rpos.col    = curcol;
+  rpos.tokidx = ((tokfile == curfile) and tokfile ? curtok : -1);
 }
 
 void OScFeederBase::SetCurPos(OScPosition & rpos)
@@ -324,6 +395,13 @@ void OScFeederBase::SetCurPos(OScPosition & rpos)
   prevp   = curp;
   prevlen = 0;
   SearchClStart();
+
+  // backtracking is a token index reset, the SyncToken() continues from here without searching
+  if (rpos.tokidx >= 0)
+  {
+    tokfile = curfile;
+    curtok  = rpos.tokidx;
+  }
 }
 
 void OScFeederBase::SetCurPos(OScFile * afile, char * apos)
@@ -358,32 +436,149 @@ void OScFeederBase::SearchClStart()
     return;
   }
 
-  char * pstart = curfile->pstart;
-  char * p = curp;
-  if (curp > curfile->pstart)
-  {
-    while (p > pstart)
-    {
-      if ((*p == '\n') or (*p == '\r'))
-      {
-        clstart = p + 1;
-        return;
-      }
-      --p;
-    }
-    // no previous linefeed was found, so point to the file start
-    clstart = pstart;
-  }
+  clstart = curfile->LineStart(curfile->LineIndex(curp));
 }
 
 void OScFeederBase::RecalcCurLineCol()
 {
-  OScPosition scpos(curfile, curp); // calculates the line, col internally, this is slow
+  OScPosition scpos(curfile, curp); // calculates the line, col internally
   curline = scpos.line;
   curcol  = scpos.col;
   SearchClStart();
 }
 
+SScToken * OScFeederBase::SyncToken()
+{
+  if (!curfile->tokenized)
+  {
+    OScLexer lexer;
+    lexer.Tokenize(curfile);
+  }
+
+  if (curfile->tokens.empty())
+  {
+    return nullptr;  // the lexer could not process this file
+  }
+
+  uint32_t offs = curp - curfile->pstart;
+  SScToken * toks = curfile->tokens.data();
+  if ((tokfile != curfile) or (toks[curtok].offset > offs))
+  {
+    // file switch or a position without a saved token index
+    tokfile = curfile;
+    curtok = curfile->TokenIndex(offs);
+  }
+  else
+  {
+    while (toks[curtok].offset + toks[curtok].length <= offs)
+    {
+      ++curtok;
+    }
+  }
+
+  return &toks[curtok];
+}
+
+SScToken * OScFeederBase::CurToken()
+{
+  if (!curfile or (curp >= bufend))
+  {
+    return nullptr;
+  }
+
+  SScToken * tok = SyncToken();
+  if (tok and (curfile->pstart + tok->offset == curp))
+  {
+    return tok;
+  }
+  return nullptr;
+}
+
+void OScFeederBase::ConsumeTokens(SScToken * atok, int acount)
+{
+  SScToken * last = atok + acount - 1;
+  curp   = curfile->pstart + last->offset + last->length;
+  curcol = (curp - clstart) + 1;
+  curtok = (atok - curfile->tokens.data()) + acount;
+}
+
+bool OScFeederBase::CheckTokSymbol(const char * asymbols, bool aconsume)
+{
+  SScToken * tok = CurToken();
+  if (!tok)
+  {
+    return CheckSymbol(asymbols, aconsume);
+  }
+
+  if (prevpos.pos != curp)
+  {
+    SaveCurPos(prevpos);  // for precise error position tracking
+  }
+
+  // the lexer produces single character symbols, the operators are their adjacent runs
+  int n = 0;
+  for (const char * sp = asymbols; *sp; ++sp, ++n)
+  {
+    SScToken & t = tok[n];
+    if ((SCTK_SYMBOL != t.kind) or (t.identid != uint8_t(*sp)) or (t.offset != tok->offset + n))
+    {
+      return false;
+    }
+  }
+
+  if (aconsume and (n > 0))
+  {
+    ConsumeTokens(tok, n);
+  }
+  return true;
+}
+
+bool OScFeederBase::CheckTokIdentifier(int32_t aidentid, bool aconsume)
+{
+  if (prevpos.pos != curp)
+  {
+    SaveCurPos(prevpos);  // for precise error position tracking
+  }
+
+  SScToken * tok = CurToken();
+  if (tok)
+  {
+    if ((SCTK_IDENTIFIER != tok->kind) or (tok->identid != aidentid))
+    {
+      return false;
+    }
+    if (aconsume)
+    {
+      ConsumeTokens(tok, 1);
+    }
+    return true;
+  }
+
+  uint32_t len = IdentifierLength();
+  if ((0 == len) or (g_idents.Name(aidentid) != string_view(curp, len)))
+  {
+    return false;
+  }
+  if (aconsume)
+  {
+    curp += len;
+    curcol = (curp - clstart) + 1;
+  }
+  return true;
+}
+
+int32_t OScFeederBase::CurIdentId()
+{
+  SScToken * tok = CurToken();
+  if (tok)
+  {
+    return (SCTK_IDENTIFIER == tok->kind ? tok->identid : -1);
+  }
+
+  uint32_t len = IdentifierLength();
+  return (len > 0 ? g_idents.Intern(curp, len) : -1);
+}
+
 void OScFeederBase::SkipSpaces(bool askiplineend)
 {
   char * cp = curp;
@@ -578,14 +773,21 @@ bool OScFeederBase::CheckSymbol(const char * checkstring, bool aconsume)
   // the checkstring should not contain the line_end_char
 
   char *  p = curp;
-  char *  csptr = (char *)checkstring;
-  char *  csend = csptr + strlen(checkstring);
 
   if (prevpos.pos != p)
   {
     SaveCurPos(prevpos);  // for precise error position tracking
   }
 
+  // most of the checks fail at the first character, do not measure the string for those
+  if ((p >= bufend) or (*p != *checkstring))
+  {
+    return (0 == *checkstring);
+  }
+
+  char *  csptr = (char *)checkstring;
+  char *  csend = csptr + strlen(checkstring);
+
   while ((csptr < csend) && (p < bufend) && (*csptr == *p))
   {
     ++csptr;
@@ -614,21 +816,18 @@ bool OScFeederBase::ReadIdentifier(string & rvalue, bool aconsume)
   }
   char *   p = curp;
   prevp = curp;
-  while (p < bufend)
-  {
-    char c = *p;
 
-    if (
-        ((c >= 'A') and (c <= 'Z')) or ((c >= 'a') and (c <= 'z')) or (c == '_')  // allowed anywhere
-        or ((p != curp) and (c >= '0') and (c <= '9'))  // numbers can not be the first one
-       )
-    {
-      ++p;
-    }
-    else
-    {
-      break;
-    }
+  // at a token start the lexer has already measured and interned the identifier
+  SScToken * tok = (tokfile == curfile and tokfile ? &curfile->tokens[curtok] : nullptr);
+  if (tok and (SCTK_IDENTIFIER == tok->kind) and (curfile->pstart + tok->offset == curp))
+  {
+    p += tok->length;
+    previdentid = tok->identid;
+  }
+  else
+  {
+    p += IdentifierLength();
+    previdentid = (p > curp ? g_idents.Intern(curp, p - curp) : -1);
   }
 
   prevlen = p - curp;
@@ -646,6 +845,28 @@ bool OScFeederBase::ReadIdentifier(string & rvalue, bool aconsume)
   return false;
 }
 
+uint32_t OScFeederBase::IdentifierLength()
+{
+  char * p = curp;
+  while (p < bufend)
+  {
+    char c = *p;
+
+    if (
+        ((c >= 'A') and (c <= 'Z')) or ((c >= 'a') and (c <= 'z')) or (c == '_')  // allowed anywhere
+        or ((p != curp) and (c >= '0') and (c <= '9'))  // numbers can not be the first one
+       )
+    {
+      ++p;
+    }
+    else
+    {
+      break;
+    }
+  }
+  return p - curp;
+}
+
 bool OScFeederBase::IsIntLiteral()
 {
   if (curp >= bufend)  return false;
@@ -17,6 +17,7 @@
 #include <vector>
 #include "stdint.h"
 #include "ll_defs.h"
+#include "scf_lexer.h"
 
 #include "comp_config.h"
 
@@ -28,10 +29,16 @@ public:
   int       index = 0;
   string    name = "";
   string    fullpath = "";
-  string    body = "";
+  string    body = "";         // file contents in copy mode
   int32_t   length = -1;
   char *    pstart = nullptr;
   char *    pend   = nullptr;
+  bool      mapped = false;    // pstart points into a read-only file mapping (mmap) instead of the body
+
+  vector<int32_t>  linestarts;  // offsets of the line starts, built once at load
+
+  vector<SScToken> tokens;      // built by the OScLexer at the first use
+  bool             tokenized = false;
 
   int       usagecount = 1;
 
@@ -41,6 +48,19 @@ public:
   ~OScFile();
 
   bool Load(const string aname, const string afullpath);
+  void Unload();
+
+  inline string_view Text()  { return (pstart ? string_view(pstart, pend - pstart) : string_view()); }
+
+  int LineIndex(const char * apos);  // zero based line index, binary search in the linestarts
+  inline char * LineStart(int alineidx)  { return pstart + linestarts[alineidx]; }
+
+  int TokenIndex(uint32_t aoffset);  // the first token which ends after the offset, binary search
+
+protected:
+  bool LoadMapped();  // returns false when the file can not be mapped (pipes, special files)
+  bool LoadCopy();
+  void BuildLineIndex();
 };
 
 class OScPosition
@@ -50,6 +70,7 @@ public:
   char *     pos;
   int        line;
   int        col;
+  int        tokidx;  // token cursor of the feeder at the SaveCurPos(), -1 = unknown
 
   OScPosition()
   {
@@ -57,13 +78,15 @@ public:
     pos    = nullptr;
     line   = 0;
     col    = 0;
+    tokidx = -1;
   }
 
   OScPosition(OScFile * ascfile, char * apos)
   {
     scfile = ascfile;
     pos    = apos;
-    RecalcLineCol(); // this is slow
+    tokidx = -1;
+    RecalcLineCol();
   }
 
   void Assign(OScPosition & ascpos)
@@ -72,9 +95,10 @@ public:
     pos    = ascpos.pos;
     line   = ascpos.line;
     col    = ascpos.col;
+    tokidx = ascpos.tokidx;
   }
 
-  void RecalcLineCol(); // this is slow, searches lineends backwards
+  void RecalcLineCol(); // binary search in the line index of the file
 
   string Format();
 };
@@ -97,6 +121,10 @@ public:
 
   OScPosition          prevpos;
 
+  OScFile *            tokfile = nullptr;   // the file of the curtok
+  int                  curtok = 0;          // token cursor, synchronized to the curp by the SkipWhite(), restored by the SetCurPos()
+  int32_t              previdentid = -1;    // interned id of the last identifier read
+
   OScFeederBase();
   virtual ~OScFeederBase();
 
@@ -110,6 +138,15 @@ public: // parsing functions
   void SetCurPos(OScFile * afile, char * apos = nullptr);
 
   void SkipSpaces(bool askiplineend = true);  // jumps to the first non-space character
+  SScToken * SyncToken();  // moves the curtok to the token at or after the curp, tokenizes the file at the first call
+
+  // token cursor: the checks compare the kind and the id of the token at the curp, and fall back to
+  // the characters when the curp is not at a token start (file without tokens, inside a literal)
+  SScToken * CurToken();  // the token which starts at the curp, nullptr otherwise
+  bool CheckTokSymbol(const char * asymbols, bool aconsume = true);  // adjacent symbol tokens, like "<<="
+  bool CheckTokIdentifier(int32_t aidentid, bool aconsume = true);  // whole word, by the interned id
+  int32_t CurIdentId();  // interned id of the identifier at the curp, -1 when there is none
+  void ConsumeTokens(SScToken * atok, int acount);
 
   bool IsIntLiteral();  // is an integer literal at the current position?
   bool IsNumChar();     // is a number [0-9] at the current position?
@@ -121,6 +158,7 @@ public: // parsing functions
   bool SearchPattern(const char * checkchars, bool aconsume = true);  // sets prevptr, prevlen
 
   bool ReadIdentifier(string & rvalue, bool aconsume = true);  // returns "" when invalid
+  uint32_t IdentifierLength();  // of the identifier at the curp, 0 when there is none
   bool ReadInt64Value(int64_t & rvalue);
   bool ReadHex64Value(uint64_t & rvalue);
   bool ReadQuotedString(string & rvalue);
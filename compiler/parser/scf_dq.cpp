@@ -131,7 +131,7 @@ OScFile * OScFeederDq::LoadFile(const string afilename)
 
   if (g_opt.verblevel >= VERBLEVEL_INFO)
   {
-    print("File \"{}\" loaded: {} bytes\n", fullname, f->length);
+    print("File \"{}\" loaded: {} bytes{}\n", fullname, f->length, (f->mapped ? " (mapped)" : ""));
   }
 
   scfiles.push_back(f);
@@ -154,6 +154,42 @@ void OScFeederDq::SkipWhite()
     return;
   }
 
+  // fast path: the token array tells where the next token starts, the whitespace and
+  // comments in between are not scanned again. The directives, the inactive code and
+  // the file ends are processed by the character level loop below, and so are the
+  // positions which the lexer saw differently (error recovery may stop inside a string
+  // or a comment).
+  if (not inactive_code and (curp < bufend))
+  {
+    SScToken * tok = SyncToken();
+    if (tok and (tok->kind < SCTK_DIRECTIVE))
+    {
+      char * tokp = curfile->pstart + tok->offset;
+      char * gapstart = curfile->pstart;
+      if (curtok > 0)
+      {
+        gapstart += tok[-1].offset + tok[-1].length;
+      }
+
+      if ((tokp > curp) and (gapstart == curp))  // the gap is entered at its start
+      {
+        curp    = tokp;
+        curline = tok->line + 1;
+        clstart = curfile->LineStart(tok->line);
+      }
+
+      if ((tokp == curp) or ((tokp < curp) and (SCTK_STRING != tok->kind)))  // at a token start or inside a token
+      {
+        RecalcCurCol();
+        if (prevpos.pos != curp)
+        {
+          SaveCurPos(prevpos);  // for precise error position tracking
+        }
+        return;
+      }
+    }
+  }
+
 repeat_skip:  // jumped here when returning from an include
 
   while (curp < bufend)
@@ -18,6 +18,7 @@
 #include "stdint.h"
 #include "scf_base.h"
 #include "errorcodes.h"
+#include "dqc_keywords.h"
 
 using namespace std;
 
@@ -76,6 +77,9 @@ public: // parsing functions
 
   void SkipWhite(); // jumps to the first normal token
 
+  inline EKeyword CurKeyword()  { return KeywordOfId(CurIdentId()); }
+  inline bool CheckTokKeyword(EKeyword akw, bool aconsume = true)  { return CheckTokIdentifier(KeywordIdentId(akw), aconsume); }
+
 protected:
 
   OScfCondition *      curcond = nullptr;
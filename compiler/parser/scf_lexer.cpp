@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    scf_lexer.cpp
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   source file tokenizer
+ */
+
+#include "string.h"
+
+#include <algorithm>
+
+#include "scf_lexer.h"
+#include "scf_base.h"
+#include "comp_timing.h"
+
+static inline bool IsIdentStart(char c)
+{
+  return ((c >= 'A') and (c <= 'Z')) or ((c >= 'a') and (c <= 'z')) or (c == '_');
+}
+
+static inline bool IsIdentChar(char c)
+{
+  return IsIdentStart(c) or ((c >= '0') and (c <= '9'));
+}
+
+char * OScLexer::StringEnd(char * p)
+{
+  // follows the OScFeederBase::ReadQuotedString(): the string must be closed in the same line
+  char quote = *p;
+  ++p;
+  while (p < pend)
+  {
+    char c = *p;
+    if (quote == c)
+    {
+      return p + 1;
+    }
+    else if ('\\' == c)
+    {
+      ++p;
+      if ((p < pend) and (('"' == *p) or ('\'' == *p) or ('n' == *p) or ('r' == *p) or ('t' == *p) or ('\\' == *p)))
+      {
+        ++p;
+      }
+    }
+    else if (('\n' == c) or ('\r' == c))
+    {
+      return nullptr;
+    }
+    else
+    {
+      ++p;
+    }
+  }
+  return nullptr;
+}
+
+bool OScLexer::Tokenize(OScFile * afile)
+{
+  // Every character which is not whitespace or comment belongs to a token, so the feeder
+  // can jump over the gaps without rescanning them. The literals are only delimited here,
+  // their values are read by the feeder.
+
+  TTimeClock::time_point t0 = TTimeClock::now();
+
+  afile->tokens.clear();
+  afile->tokenized = true;
+
+  pstart = afile->pstart;
+  pend   = afile->pend;
+  line   = 0;
+
+  vector<SScToken> & tokens = afile->tokens;
+  tokens.reserve((pend - pstart) / 5 + 1);
+
+  char * p = pstart;
+  while (p < pend)
+  {
+    char c = *p;
+
+    if ((' ' == c) or ('\t' == c) or ('\r' == c))
+    {
+      ++p;
+      continue;
+    }
+
+    if ('\n' == c)
+    {
+      ++line;
+      ++p;
+      continue;
+    }
+
+    if (('/' == c) and (p + 1 < pend) and ('/' == p[1]))  // single line comment
+    {
+      p += 2;
+      while ((p < pend) and ('\n' != *p) and ('\r' != *p))
+      {
+        ++p;
+      }
+      continue;
+    }
+
+    if (('/' == c) and (p + 1 < pend) and ('*' == p[1]))  // multi-line comment, an unclosed one lasts until the end
+    {
+      p += 2;
+      while ((p < pend) and not (('*' == *p) and (p + 1 < pend) and ('/' == p[1])))
+      {
+        if ('\n' == *p)
+        {
+          ++line;
+        }
+        ++p;
+      }
+      p = min(p + 2, pend);
+      continue;
+    }
+
+    SScToken tok;
+    tok.offset  = p - pstart;
+    tok.identid = -1;
+    tok.line    = line;
+
+    char * tokend = p + 1;
+    if (IsIdentStart(c))
+    {
+      while ((tokend < pend) and IsIdentChar(*tokend))
+      {
+        ++tokend;
+      }
+      tok.kind = SCTK_IDENTIFIER;
+      tok.identid = g_idents.Intern(p, tokend - p);
+    }
+    else if ((c >= '0') and (c <= '9'))
+    {
+      // the range operator must remain separate: "0..16"
+      while ((tokend < pend)
+             and (IsIdentChar(*tokend)
+                  or (('.' == *tokend) and (tokend + 1 < pend) and (tokend[1] >= '0') and (tokend[1] <= '9'))))
+      {
+        ++tokend;
+      }
+      tok.kind = SCTK_NUMBER;
+    }
+    else if (('"' == c) or ('\'' == c))
+    {
+      char * send = StringEnd(p);
+      if (send)
+      {
+        tokend = send;
+        tok.kind = SCTK_STRING;
+      }
+      else
+      {
+        tok.kind = SCTK_SYMBOL;  // unterminated, the parser reports it
+        tok.identid = uint8_t(c);
+      }
+    }
+    else if ('#' == c)
+    {
+      tok.kind = SCTK_DIRECTIVE;
+    }
+    else
+    {
+      tok.kind = SCTK_SYMBOL;
+      tok.identid = uint8_t(c);
+    }
+
+    tok.length = tokend - p;
+    tokens.push_back(tok);
+    p = tokend;
+  }
+
+  SScToken tok;
+  tok.offset  = pend - pstart;
+  tok.length  = 1;
+  tok.identid = -1;
+  tok.line    = line;
+  tok.kind    = SCTK_END;
+  tokens.push_back(tok);
+
+  if (line >= (1u << 24))  // does not fit into the token line field, the feeder works without tokens
+  {
+    tokens.clear();
+    tokens.shrink_to_fit();
+    return false;
+  }
+
+  g_timer.AddLexer(tokens.size(), chrono::duration<double>(TTimeClock::now() - t0).count());
+  return true;
+}
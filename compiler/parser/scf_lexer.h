@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    scf_lexer.h
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   source file tokenizer
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "stdint.h"
+#include "dqc_idents.h"
+
+using namespace std;
+
+class OScFile;
+
+enum EScTokenKind
+{
+  SCTK_IDENTIFIER  = 0,
+  SCTK_NUMBER      = 1,
+  SCTK_STRING      = 2,   // quoted string or character literal, including the quotes
+  SCTK_SYMBOL      = 3,   // a single character, the multi-character operators are built by the parser
+  SCTK_DIRECTIVE   = 4,   // the "#" of a compiler directive
+  SCTK_END         = 5    // the end of the file (one virtual character)
+};
+
+// 16 bytes per token, whitespace and comments do not produce tokens
+struct SScToken
+{
+  uint32_t   offset;      // source offset of the first character
+  uint32_t   length;
+  int32_t    identid;     // interned identifier id, the character code of a symbol, -1 for the other kinds
+  uint32_t   line : 24;   // zero based line index
+  uint32_t   kind : 8;    // EScTokenKind
+};
+
+// The parser consumes the tokens at the token cursor of the feeder (CurToken(), CheckTokSymbol(),
+// CheckTokIdentifier()): the punctuation and the keywords are compared by the token kind and id,
+// backtracking resets the token index. The literal values, the directives and the error recovery
+// (ReadTo(), SearchPattern()) still work on the characters.
+class OScLexer
+{
+public:
+  bool Tokenize(OScFile * afile);  // fills the afile->tokens, returns false when the file is too large
+
+protected:
+  char *     pstart = nullptr;
+  char *     pend = nullptr;
+  uint32_t   line = 0;
+
+  char * StringEnd(char * p);  // returns nullptr for an unterminated string
+};
@@ -13,7 +13,7 @@
 
 #include "comp_options.h"
 
-OCompOptions  g_opt;
+thread_local OCompOptions  g_opt;
 
 OCompOptions::OCompOptions()
 {
@@ -26,6 +26,20 @@ enum EVerboseLevel
   VERBLEVEL_DEBUG  = 3,   // -vvv or -v3
 };
 
+enum EFpContract
+{
+  FPCONTRACT_OFF   = 0,   // -ffp-contract=off (default): no fused multiply-add
+  FPCONTRACT_ON    = 1,   // -ffp-contract=on: fused multiply-add within an expression only
+  FPCONTRACT_FAST  = 2,   // -ffp-contract=fast: the code generator fuses wherever possible
+};
+
+enum EIntOverflow
+{
+  INTOVF_WRAP  = 0,  // -fint-overflow=wrap (default): two's complement wrap around
+  INTOVF_NSW   = 1,  // -fint-overflow=nsw: signed overflow is undefined (no-signed-wrap), faster loops
+  INTOVF_TRAP  = 2,  // -fint-overflow=trap: checked arithmetic, traps on overflow
+};
+
 class OCmdLineDefine
 {
 public:
@@ -40,6 +54,7 @@ class OCompOptions
 {
 public:
   bool     print_version = false;  // --version
+  bool     full_teardown = false;  // --full-teardown: destroy the compiler state before the exit (leak checking)
   int      verblevel = VERBLEVEL_NONE;
 
   bool     dbg_info = false;  // -g
@@ -48,10 +63,36 @@ public:
 
   bool     compile_only = false;  // -c
 
+  int      jobs = 0;  // -j <n>, 0 = number of CPUs
+  int      codegen_threads = 1;  // -fcodegen-threads=<n>
+  bool     lto = false;  // -flto: bitcode objects, whole program optimization at link time
+
+  bool     jit_run = false;  // dq-run --jit: run main() in-process, no object file
+
   int      optlevel = 0;
 
+  bool     fast_math = false;  // -ffast-math
+  int      fp_contract = FPCONTRACT_OFF;  // -ffp-contract=off|on|fast
+  int      int_overflow = INTOVF_WRAP;    // -fint-overflow=wrap|nsw|trap
+  bool     bounds_check = false;          // -fbounds-check: index range checks for arrays, slices and cstrings
+
+  bool     time_report = false;   // -ftime-report
+  string   time_trace_file = "";  // -ftime-trace[=<file>]
+  bool     stats = false;         // -fstats: arena allocation counts and peak memory
+
+  string   target_cpu = "generic";   // -march=native, -mcpu=<name>
+  string   target_features = "";     // -mattr=+feat1,-feat2,...
+
+  bool     mmap_sources = true;  // -fno-mmap: read the source files into memory instead of mapping
+
   bool     blockmode_braces = false;
 
+  string   linker = "";  // -fuse-ld=<name|path>, empty = ld
+
+  bool     use_cache = false;                   // -fcache
+  string   cache_dir = "";                      // -fcache-dir=<dir>, empty = ~/.cache/dq-comp/objcache
+  uint64_t cache_size_limit = 256 * 1024 * 1024;  // -fcache-size=<n>[K|M|G]
+
   vector<OCmdLineDefine>  cmdline_defines;
   vector<string>          link_libraries;
 
@@ -61,4 +102,4 @@ public:
   OCompOptions();
 };
 
-extern OCompOptions  g_opt;
+extern thread_local OCompOptions  g_opt;  // copied to every compilation thread
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    comp_timing.cpp
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   compilation phase timing (-ftime-report, -ftime-trace)
+ */
+
+// these include also provide llvm::format() so the std::format() must be fully specified
+#include <llvm/Support/TimeProfiler.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/FileSystem.h>
+
+#include <print>
+#include <format>
+#include <algorithm>
+#include <sys/resource.h>
+
+#include "comp_timing.h"
+#include "comp_options.h"
+
+thread_local OCompTimer  g_timer;
+
+static double SecondsSince(TTimeClock::time_point astart)
+{
+  return chrono::duration<double>(TTimeClock::now() - astart).count();
+}
+
+// pass managers and adaptors only contain other passes, they are not counted in the pass list
+static bool IsContainerPass(const string & aname)
+{
+  return (aname.find("PassManager") != string::npos)
+         or (aname.find("PassAdaptor") != string::npos)
+         or (aname.find("WrapperPass") != string::npos)
+         or (aname.find("RepeatedPass") != string::npos);
+}
+
+void OCompTimer::Init(const string & aprocname)
+{
+  report = g_opt.time_report;
+  trace = !g_opt.time_trace_file.empty();
+  start_time = TTimeClock::now();
+  if (trace)
+  {
+    llvm::timeTraceProfilerInitialize(0, aprocname);
+  }
+}
+
+void OCompTimer::Finish()
+{
+  if (report)
+  {
+    PrintReport();
+  }
+
+  if (trace)
+  {
+    WriteTrace();
+    llvm::timeTraceProfilerCleanup();
+  }
+}
+
+void OCompTimer::AddPhase(const string & aname, double aseconds)
+{
+  phases.push_back({aname, aseconds, 1});
+}
+
+void OCompTimer::AddSourceLoad(uint64_t abytes, bool amapped, double aseconds)
+{
+  ++source_files;
+  if (amapped)
+  {
+    ++source_mapped;
+  }
+  source_bytes += abytes;
+  source_load_seconds += aseconds;
+}
+
+void OCompTimer::AddLexer(uint64_t atokens, double aseconds)
+{
+  lexer_tokens += atokens;
+  lexer_seconds += aseconds;
+}
+
+void OCompTimer::PassBegin(const string & aname)
+{
+  if (trace)
+  {
+    llvm::timeTraceProfilerBegin(aname, "");
+  }
+  pass_start_stack.push_back(TTimeClock::now());
+}
+
+void OCompTimer::PassEnd(const string & aname)
+{
+  if (pass_start_stack.empty())
+  {
+    return;
+  }
+
+  double elapsed = SecondsSince(pass_start_stack.back());
+  pass_start_stack.pop_back();
+  if (trace)
+  {
+    llvm::timeTraceProfilerEnd();
+  }
+
+  if (!IsContainerPass(aname))
+  {
+    STimeRecord & rec = passes[aname];
+    rec.name = aname;
+    rec.seconds += elapsed;
+    rec.count += 1;
+  }
+}
+
+void OCompTimer::PrintReport()
+{
+  double total = SecondsSince(start_time);
+  double pct_base = (total > 0 ? 100.0 / total : 0);
+
+  print("=== Compilation time report ===\n");
+  print("  {:<36} {:>10} {:>7}\n", "Phase", "Time (ms)", "%");
+  for (STimeRecord & rec : phases)
+  {
+    print("  {:<36} {:>10.3f} {:>6.1f}%\n", rec.name, rec.seconds * 1000, rec.seconds * pct_base);
+  }
+  print("  {:<36} {:>10.3f}\n", "Total", total * 1000);
+
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  print("--- Source files and memory ---\n");
+  print("  Source files: {} ({} mapped, {} copied), {} bytes, loaded in {:.3f} ms\n", source_files,
+        source_mapped, source_files - source_mapped, source_bytes, source_load_seconds * 1000);
+  print("  Tokens: {}, tokenized in {:.3f} ms\n", lexer_tokens, lexer_seconds * 1000);
+  print("  Peak RSS: {} KB\n", ru.ru_maxrss);
+
+  if (passes.empty())
+  {
+    return;
+  }
+
+  vector<STimeRecord *> sorted;
+  double pass_total = 0;
+  for (auto & [name, rec] : passes)
+  {
+    sorted.push_back(&rec);
+    pass_total += rec.seconds;
+  }
+  sort(sorted.begin(), sorted.end(),
+       [](STimeRecord * a, STimeRecord * b) { return a->seconds > b->seconds; });
+
+  print("--- LLVM optimization passes ---\n");
+  print("  {:<36} {:>10} {:>7} {:>6}\n", "Pass", "Time (ms)", "%", "Runs");
+  for (STimeRecord * rec : sorted)
+  {
+    print("  {:<36} {:>10.3f} {:>6.1f}% {:>6}\n", rec->name, rec->seconds * 1000, rec->seconds * pct_base, rec->count);
+  }
+  print("  {:<36} {:>10.3f}\n", "Total passes", pass_total * 1000);
+}
+
+bool OCompTimer::WriteTrace()
+{
+  error_code ec;
+  llvm::raw_fd_ostream out(g_opt.time_trace_file, ec, llvm::sys::fs::OF_Text);
+  if (ec)
+  {
+    print("Error writing time trace file \"{}\": {}\n", g_opt.time_trace_file, ec.message());
+    return false;
+  }
+
+  llvm::timeTraceProfilerWrite(out);
+  return true;
+}
+
+/* ctor */ OTimeScope::OTimeScope(const string & aname, const string & adetail, bool aadd_phase)
+{
+  name = aname;
+  add_phase = aadd_phase;
+  if (g_timer.trace)
+  {
+    llvm::timeTraceProfilerBegin(aname, adetail);
+  }
+  if (g_timer.Enabled())
+  {
+    start_time = TTimeClock::now();
+  }
+}
+
+OTimeScope::~OTimeScope()
+{
+  Stop();
+}
+
+void OTimeScope::Stop()
+{
+  if (!running)
+  {
+    return;
+  }
+
+  running = false;
+  if (g_timer.trace)
+  {
+    llvm::timeTraceProfilerEnd();
+  }
+  if (add_phase and g_timer.report)
+  {
+    g_timer.AddPhase(name, SecondsSince(start_time));
+  }
+}
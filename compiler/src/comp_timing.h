@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    comp_timing.h
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   compilation phase timing (-ftime-report, -ftime-trace)
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include "stdint.h"
+
+using namespace std;
+
+using TTimeClock = chrono::steady_clock;
+
+struct STimeRecord
+{
+  string   name;
+  double   seconds = 0;
+  int      count = 0;
+};
+
+class OCompTimer
+{
+public:
+  bool                         report = false;  // -ftime-report
+  bool                         trace = false;   // -ftime-trace
+
+  vector<STimeRecord>          phases;
+  map<string, STimeRecord>     passes;
+
+  TTimeClock::time_point       start_time;
+  vector<TTimeClock::time_point>  pass_start_stack;
+
+  // source loading statistics
+  int                          source_files = 0;
+  int                          source_mapped = 0;
+  uint64_t                     source_bytes = 0;
+  double                       source_load_seconds = 0;
+  uint64_t                     lexer_tokens = 0;
+  double                       lexer_seconds = 0;
+
+public:
+  void Init(const string & aprocname);
+  void Finish();  // prints the report and writes the trace file
+
+  void AddPhase(const string & aname, double aseconds);
+  void AddSourceLoad(uint64_t abytes, bool amapped, double aseconds);
+  void AddLexer(uint64_t atokens, double aseconds);
+
+  // called from the LLVM pass instrumentation callbacks
+  void PassBegin(const string & aname);
+  void PassEnd(const string & aname);
+
+  void PrintReport();
+  bool WriteTrace();
+
+  inline bool Enabled() const
+  {
+    return (report or trace);
+  }
+};
+
+extern thread_local OCompTimer  g_timer;
+
+// Measures a phase (or a sub-phase with detail like a function name) until the end of its scope
+class OTimeScope
+{
+public:
+  string                  name;
+  bool                    add_phase;
+  bool                    running = true;
+  TTimeClock::time_point  start_time;
+
+  OTimeScope(const string & aname, const string & adetail = "", bool aadd_phase = true);
+  ~OTimeScope();
+
+  void Stop();  // ends the measurement before the end of the scope
+};
@@ -15,6 +15,9 @@
 #include <format>
 #include <cstdlib>
 #include <cstdio>
+#include <thread>
+#include <semaphore>
+#include <algorithm>
 
 #include "ll_defs.h"
 #include "named_scopes.h"
@@ -24,8 +27,12 @@
 #include "dqc.h"
 #include "dq_module.h"
 #include "version.h"
+#include "comp_timing.h"
+#include "dqc_link.h"
+#include "dqc_cache.h"
+#include "dqc_arena.h"
 
-ODqCompiler *  g_compiler = nullptr;
+thread_local ODqCompiler *  g_compiler = nullptr;
 
 ODqCompiler::ODqCompiler()
 {
@@ -38,7 +45,6 @@ ODqCompiler::~ODqCompiler()
 void ODqCompiler::Run(int argc, char ** argv)
 {
   errorcnt = 0;
-  OScPosition scpos;
 
   ParseCmdLineArgsVerblevel(argc, argv);
   if (g_opt.verblevel >= VERBLEVEL_STATUS)
@@ -58,11 +64,37 @@ void ODqCompiler::Run(int argc, char ** argv)
     return;
   }
 
+  if (in_filenames.size() > 1)
+  {
+    CompileParallel();
+    return;
+  }
+
   if ((g_opt.verblevel >= VERBLEVEL_STATUS) and not in_filename.empty())
   {
     print("Compiling: \"{}\"...\n", in_filename);
   }
 
+  ApplyCmdLineDefines();
+  if (errorcnt)
+  {
+    return;
+  }
+
+  g_timer.Init("dq-comp");
+  Compile();
+  OCompCache::PrintStats();
+  g_timer.Finish();
+  if (g_opt.stats)
+  {
+    g_arena.PrintStats("");
+  }
+}
+
+void ODqCompiler::ApplyCmdLineDefines()
+{
+  OScPosition scpos;
+
   for (const OCmdLineDefine & def : g_opt.cmdline_defines)
   {
     if (def.has_bool_value)
@@ -78,35 +110,88 @@ void ODqCompiler::Run(int argc, char ** argv)
       g_defines->DefineValSym(g_builtins->type_bool->CreateConst(scpos, def.name, true));
     }
   }
-  if (errorcnt)
+}
+
+void ODqCompiler::Compile()
+{
+  if (!CompileUnit())
   {
     return;
   }
 
+  // linking decision
+  if (!g_opt.compile_only)
+  {
+    if (has_main)
+    {
+      vector<string> objects = {out_filename};
+      objects.insert(objects.end(), in_objects.begin(), in_objects.end());
+      Link(objects, g_opt.link_libraries);
+    }
+    else if (has_dash_o)
+    {
+      // no main(), no linking — rename .o to -o target if different
+      if (out_filename != link_output)
+      {
+        rename(out_filename.c_str(), link_output.c_str());
+      }
+    }
+  }
+
+  if ((0 == errorcnt) and (g_opt.verblevel >= VERBLEVEL_STATUS))
+  {
+    print("OK.\n");
+  }
+}
+
+bool ODqCompiler::CompileUnit()
+{
   // initialize the source code feeder:
-  if (scf->Init(in_filename) != 0)
   {
-    ++errorcnt;
-    return;
+    OTimeScope ts("Source load");
+    if (scf->Init(in_filename) != 0)
+    {
+      ++errorcnt;
+      return false;
+    }
+  }
+
+  // the object cache is not used when the IR is required
+  bool use_cache = (g_opt.use_cache and !g_opt.jit_run and !g_opt.ir_print);
+  OCompCache cache;
+  if (use_cache and cache.Lookup(scf->scfiles[0], out_filename))
+  {
+    has_main = cache.has_main;
+    for (const string & libname : cache.link_libraries)
+    {
+      if (g_opt.link_libraries.end() == find(g_opt.link_libraries.begin(), g_opt.link_libraries.end(), libname))
+      {
+        g_opt.link_libraries.push_back(libname);
+      }
+    }
+    return true;
   }
 
   ll_init_debug_info();
 
-  ParseModule();
+  {
+    OTimeScope ts("Parse");
+    ParseModule();
+  }
   if (errorcnt)
   {
     if (g_opt.verblevel >= VERBLEVEL_STATUS)
     {
       print("Compile error.\n");
     }
-    return;
+    return false;
   }
 
   GenerateIr();
   if (errorcnt)
   {
     print("Code generation error.\n");
-    return;
+    return false;
   }
 
   if (g_opt.ir_print)
@@ -114,58 +199,175 @@ void ODqCompiler::Run(int argc, char ** argv)
     PrintIr();
   }
 
-  EmitObject(out_filename);
-  if (errorcnt)
+  if (g_opt.jit_run)
   {
-    return;
+    OValSym * main_sym = nullptr;
+    g_module->ValSymDeclared("main", &main_sym);
+    OValSymFunc * vsmain = dynamic_cast<OValSymFunc *>(main_sym);
+    if (!vsmain)
+    {
+      ++errorcnt;
+      print("The main() function is missing.\n");
+      return false;
+    }
+
+    OTypeFunc * tfmain = static_cast<OTypeFunc *>(vsmain->ptype);
+    OTimeScope ts("JIT run");
+    jit_exit_code = JitRunMain(jit_args, (tfmain->rettype != nullptr));
+    return false;  // nothing to link
   }
 
-  // linking decision
-  if (!g_opt.compile_only)
   {
-    OValSym * main_sym = nullptr;
-    bool has_main = g_module->ValSymDeclared("main", &main_sym);
+    OTimeScope ts("Object emission");
+    EmitObject(out_filename);
+  }
 
-    if (has_main)
-    {
-      string link_cmd = format("gcc {} -o {} -lm", out_filename, link_output);
-      for (const string & libname : g_opt.link_libraries)
-      {
-        link_cmd += format(" -l{}", libname);
-      }
-      if (g_opt.verblevel >= VERBLEVEL_STATUS)
-      {
-        print("Linking: \"{}\"...\n", link_output);
-      }
-      if (g_opt.verblevel >= VERBLEVEL_INFO)
-      {
-        print("Link cmd: {}\n", link_cmd);
-      }
+  OValSym * main_sym = nullptr;
+  has_main = g_module->ValSymDeclared("main", &main_sym);
+
+  if (use_cache and (0 == errorcnt))
+  {
+    cache.Store(scf->scfiles, out_filename, has_main, g_opt.link_libraries);
+  }
+  return (0 == errorcnt);
+}
 
+void ODqCompiler::Link(const vector<string> & aobjects, const vector<string> & alibraries)
+{
+  if (g_opt.verblevel >= VERBLEVEL_STATUS)
+  {
+    print("Linking: \"{}\"...\n", link_output);
+  }
 
-      int rc = system(link_cmd.c_str());
-      if (rc != 0)
-      {
-        ++errorcnt;
-        print("Link error.\n");
-      }
+  OTimeScope ts("Link");
+  OLinkDriver linker;
+  linker.SetLinker(g_opt.linker);
+  if (!linker.Link(aobjects, alibraries, link_output))
+  {
+    ++errorcnt;
+    print("Link error.\n");
+  }
+}
+
+// runs on its own thread, so it gets a fresh (thread local) compilation state
+static void CompileJobThread(SCompileJob * ajob, const OCompOptions * aopt)
+{
+  g_opt = *aopt;
+  g_opt.time_report = false;  // the timing is measured only for the whole parallel build
+  g_opt.time_trace_file = "";
+
+  dqc_init();
+
+  g_compiler->in_filename = ajob->in_filename;
+  g_compiler->out_filename = ajob->obj_filename;
+  if (g_opt.verblevel >= VERBLEVEL_STATUS)
+  {
+    print("Compiling: \"{}\"...\n", ajob->in_filename);
+  }
+
+  g_compiler->ApplyCmdLineDefines();
+  if (!g_compiler->errorcnt and g_compiler->CompileUnit())
+  {
+    ajob->has_main = g_compiler->has_main;
+  }
+
+  ajob->errorcnt = g_compiler->errorcnt;
+  ajob->link_libraries = g_opt.link_libraries;
+  if (g_opt.stats)
+  {
+    g_arena.PrintStats(ajob->in_filename);  // every job has its own arena
+  }
+
+  delete g_compiler;
+  g_compiler = nullptr;
+}
+
+void ODqCompiler::CompileParallel()
+{
+  vector<SCompileJob> jobs(in_filenames.size());
+  for (size_t i = 0; i < jobs.size(); ++i)
+  {
+    jobs[i].in_filename = in_filenames[i];
+    jobs[i].obj_filename = ObjFileName(in_filenames[i]);
+  }
+
+  int jobcnt = g_opt.jobs;
+  if (jobcnt <= 0)
+  {
+    jobcnt = max(1, int(thread::hardware_concurrency()));
+  }
+  if (g_opt.verblevel >= VERBLEVEL_INFO)
+  {
+    print("Compiling {} files with {} jobs\n", jobs.size(), jobcnt);
+  }
+
+  g_timer.Init("dq-comp");
+
+  OTimeScope ts(format("Compilation ({} files)", jobs.size()));
+  {
+    // every job gets a new thread, the semaphore limits the number of the running ones
+    counting_semaphore<> free_slots(jobcnt);
+    const OCompOptions * mainopt = &g_opt;
+    vector<thread> threads;
+    threads.reserve(jobs.size());
+    for (SCompileJob & job : jobs)
+    {
+      free_slots.acquire();
+      threads.emplace_back(
+        [&job, mainopt, &free_slots]()
+        {
+          CompileJobThread(&job, mainopt);
+          free_slots.release();
+        }
+      );
     }
-    else if (has_dash_o)
+    for (thread & t : threads)
     {
-      // no main(), no linking — rename .o to -o target if different
-      if (out_filename != link_output)
+      t.join();
+    }
+  }
+  ts.Stop();
+
+  vector<string>  objects;
+  vector<string>  libraries;
+  int             maincnt = 0;
+  for (SCompileJob & job : jobs)
+  {
+    errorcnt += job.errorcnt;
+    objects.push_back(job.obj_filename);
+    if (job.has_main)
+    {
+      ++maincnt;
+    }
+    for (const string & libname : job.link_libraries)
+    {
+      if (libraries.end() == find(libraries.begin(), libraries.end(), libname))
       {
-        rename(out_filename.c_str(), link_output.c_str());
+        libraries.push_back(libname);
       }
     }
   }
 
+  if (errorcnt)
+  {
+    if (g_opt.verblevel >= VERBLEVEL_STATUS)
+    {
+      print("Compile error.\n");
+    }
+  }
+  else if (!g_opt.compile_only and (maincnt > 0))
+  {
+    objects.insert(objects.end(), in_objects.begin(), in_objects.end());
+    Link(objects, libraries);
+  }
+
   if ((0 == errorcnt) and (g_opt.verblevel >= VERBLEVEL_STATUS))
   {
     print("OK.\n");
   }
 
-  return;
+  OCompCache::PrintStats();
+  g_timer.Finish();
 }
 
 void dqc_init()
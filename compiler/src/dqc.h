@@ -15,6 +15,7 @@
 
 #include "stdint.h"
 #include <string>
+#include <vector>
 #include "comp_options.h"
 
 #include "dqc_clargs.h"
@@ -22,18 +23,41 @@
 
 using namespace std;
 
+// one input file of a parallel (-j) compilation
+struct SCompileJob
+{
+  string          in_filename;
+  string          obj_filename;
+  int             errorcnt = 0;
+  bool            has_main = false;
+  vector<string>  link_libraries;  // collected by #linklib
+};
+
 class ODqCompiler : public ODqCompClargs
 {
 private:
   using            super = ODqCompClargs;
 
+public:
+  vector<string>   jit_args;        // program arguments for the JIT mode, [0] = program name
+  int              jit_exit_code = 0;
+
+  bool             has_main = false;  // set by CompileUnit(), decides the linking
+
 public:
   ODqCompiler();
   virtual ~ODqCompiler();
 
   void Run(int argc, char ** argv);
+  void ApplyCmdLineDefines();
+  void Compile();          // single file compilation and linking
+  void CompileParallel();  // multiple input files on multiple threads, then linking
+  bool CompileUnit();      // compiles in_filename to out_filename, returns false on error or JIT run
+  void Link(const vector<string> & aobjects, const vector<string> & alibraries);
 };
 
-extern ODqCompiler *  g_compiler;
+// The compilation state (compiler object, module, builtins, LLVM context) is thread local,
+// every compilation unit of a parallel (-j) build runs on its own thread.
+extern thread_local ODqCompiler *  g_compiler;
 
 void dqc_init();
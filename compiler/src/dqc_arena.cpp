@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    dqc_arena.cpp
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   bump allocator for the AST, symbol and scope objects (-fstats)
+ */
+
+#include <print>
+#include <format>
+#include <cstdlib>
+#include <new>
+#include <sys/resource.h>
+
+#include "dqc_arena.h"
+
+// The first arena allocation comes from the builtin scope initialization, so the arena is
+// destroyed after the other thread locals, whose destructors may still delete arena objects.
+thread_local OArena  g_arena;
+
+OArena::~OArena()
+{
+  Release();
+}
+
+void * OArena::AllocChunk(size_t asize)
+{
+  size_t hdrsize = (sizeof(SChunk) + ALIGN - 1) & ~(ALIGN - 1);
+  bool   dedicated = (asize > CHUNK_SIZE / 4);  // large objects get their own chunk, the current one remains
+  size_t size = hdrsize + (dedicated ? asize : CHUNK_SIZE);
+
+  SChunk * chunk = static_cast<SChunk *>(malloc(size));
+  if (!chunk)
+  {
+    throw bad_alloc();
+  }
+  chunk->next = chunks;
+  chunk->size = size;
+  chunks = chunk;
+  ++chunk_count;
+  chunk_bytes += size;
+
+  char * result = reinterpret_cast<char *>(chunk) + hdrsize;
+  if (!dedicated)
+  {
+    curp = result + asize;
+    endp = reinterpret_cast<char *>(chunk) + size;
+  }
+  return result;
+}
+
+void OArena::Release()
+{
+  while (chunks)
+  {
+    SChunk * next = chunks->next;
+    free(chunks);
+    chunks = next;
+  }
+  curp = nullptr;
+  endp = nullptr;
+  for (SFreeBlock * & fl : freelist)
+  {
+    fl = nullptr;
+  }
+}
+
+void OArena::PrintStats(const string & atitle)
+{
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+
+  // a single print, the parallel jobs report from their own threads
+  string s = format("=== Allocation statistics{} ===\n", atitle.empty() ? "" : " (" + atitle + ")");
+  s += format("  AST/symbol objects: {} allocated ({} reused), {} deleted\n", alloc_count, reuse_count, delete_count);
+  s += format("  Arena: {} bytes used in {} chunks, {} bytes reserved\n", alloc_bytes, chunk_count, chunk_bytes);
+  s += format("  Peak RSS: {} KB\n", ru.ru_maxrss);
+  print("{}", s);
+}
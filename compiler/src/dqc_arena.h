@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    dqc_arena.h
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   bump allocator for the AST, symbol and scope objects (-fstats)
+ */
+
+#pragma once
+
+#include <string>
+#include <cstddef>
+#include "stdint.h"
+
+using namespace std;
+
+// Every compilation unit runs on its own thread (see dqc.h), so the arena is thread local too.
+// The objects are never freed one by one: a delete runs the destructor and puts the block on a
+// free list of its size class, the chunks are released together at the end of the compilation.
+class OArena
+{
+public:
+  static constexpr size_t  ALIGN = alignof(max_align_t);
+  static constexpr size_t  CHUNK_SIZE = 256 * 1024;
+  static constexpr size_t  FREE_CLASSES = 32;  // the free lists hold blocks up to FREE_CLASSES * ALIGN bytes
+
+  // statistics for the -fstats
+  uint64_t   alloc_count = 0;
+  uint64_t   alloc_bytes = 0;    // without the reused blocks
+  uint64_t   reuse_count = 0;    // allocations served from the free lists
+  uint64_t   delete_count = 0;
+  uint64_t   chunk_count = 0;
+  uint64_t   chunk_bytes = 0;
+
+  ~OArena();
+
+  inline void * Alloc(size_t asize)
+  {
+    asize = (asize + ALIGN - 1) & ~(ALIGN - 1);
+    ++alloc_count;
+
+    size_t fc = asize / ALIGN;
+    if ((fc < FREE_CLASSES) and freelist[fc])
+    {
+      ++reuse_count;
+      SFreeBlock * result = freelist[fc];
+      freelist[fc] = result->next;
+      return result;
+    }
+
+    alloc_bytes += asize;
+    if (asize > size_t(endp - curp))
+    {
+      return AllocChunk(asize);
+    }
+    void * result = curp;
+    curp += asize;
+    return result;
+  }
+
+  inline void Free(void * ptr, size_t asize)
+  {
+    if (!ptr)
+    {
+      return;
+    }
+    ++delete_count;
+    size_t fc = ((asize + ALIGN - 1) & ~(ALIGN - 1)) / ALIGN;
+    if (fc < FREE_CLASSES)
+    {
+      SFreeBlock * block = static_cast<SFreeBlock *>(ptr);
+      block->next = freelist[fc];
+      freelist[fc] = block;
+    }
+  }
+
+  void Release();  // frees all the chunks at once, the objects in them must not be used anymore
+  void PrintStats(const string & atitle);
+
+protected:
+  struct SChunk
+  {
+    SChunk *   next;
+    size_t     size;
+  };
+
+  struct SFreeBlock
+  {
+    SFreeBlock *  next;
+  };
+
+  SChunk *       chunks = nullptr;
+  char *         curp = nullptr;
+  char *         endp = nullptr;
+  SFreeBlock *   freelist[FREE_CLASSES] = {};
+
+  void * AllocChunk(size_t asize);
+};
+
+extern thread_local OArena  g_arena;
+
+// Base class of the arena allocated objects, it adds no data members
+class OArenaObj
+{
+public:
+  static void * operator new(size_t asize)
+  {
+    return g_arena.Alloc(asize);
+  }
+
+  static void operator delete(void * ptr, size_t asize) noexcept
+  {
+    g_arena.Free(ptr, asize);
+  }
+};
@@ -14,6 +14,7 @@
 #include <print>
 #include <format>
 #include "dqc_base.h"
+#include "dqc_keywords.h"
 
 using namespace std;
 
@@ -27,47 +28,16 @@ ODqCompBase::~ODqCompBase()
   delete scf;
 }
 
-const string dq_reserved_words =
-   "|var|ref|refin|refout|refnull|for|while|if|else|return|break|continue"
-   "|and|not|or"
-   "|NOT|AND|OR|XOR|IDIV|IMOD"
-   "|null"
-   "|function|use|implementation|initialization|finalization"
-   "|struct|endstruct|object|endobj"
-   "|"
-;
-
-bool ODqCompBase::ReservedWord(const string aname)
+bool ODqCompBase::ReservedWord(string_view aname)
 {
-  string search_target = "|" + aname + "|";
-  if (dq_reserved_words.find(search_target) != string::npos)
-  {
-    return true;
-  }
-  else
-  {
-    return false;
-  }
+  const TKeywordDef * kd = FindKeyword(aname);
+  return (kd and (kd->flags & KWF_RESERVED));
 }
 
-const string dq_root_statement_words =
-   "|var|const|type"
-   "|function|use|implementation|initialization|finalization"
-   "|struct|object"
-   "|"
-;
-
-bool ODqCompBase::RootStatementWord(const string aname)
+bool ODqCompBase::RootStatementWord(string_view aname)
 {
-  string search_target = "|" + aname + "|";
-  if (dq_root_statement_words.find(search_target) != string::npos)
-  {
-    return true;
-  }
-  else
-  {
-    return false;
-  }
+  const TKeywordDef * kd = FindKeyword(aname);
+  return (kd and (kd->flags & KWF_ROOT));
 }
 
 string ODqCompBase::FormatDiagMsg(string_view atext, string_view par1, string_view par2, string_view par3)
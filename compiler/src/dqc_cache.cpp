@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    dqc_cache.cpp
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   persistent object cache (-fcache), keyed by the source contents and the options
+ */
+
+// these include also provide llvm::format() so the std::format() must be fully specified
+#include <llvm/Support/SHA1.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/TargetParser/Host.h>
+
+#include <print>
+#include <format>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <algorithm>
+#include <map>
+#include <unistd.h>
+
+#include "dqc_cache.h"
+#include "comp_options.h"
+#include "version.h"
+
+namespace fs = std::filesystem;
+
+atomic<int>  OCompCache::hits(0);
+atomic<int>  OCompCache::misses(0);
+
+static string HashText(const string & atext)
+{
+  llvm::SHA1 sha;
+  sha.update(atext);
+  return llvm::toHex(sha.final(), true);
+}
+
+static bool ReadFileText(const string & afilename, string & rtext)
+{
+  ifstream f(afilename, ios::binary);
+  if (!f)
+  {
+    return false;
+  }
+  stringstream ss;
+  ss << f.rdbuf();
+  rtext = ss.str();
+  return true;
+}
+
+// unique per process and per compilation thread (-j), the same process may write the same entry twice
+static string TempFileName(const string & adst)
+{
+  static atomic<unsigned>  tmpcounter(0);
+  return std::format("{}.tmp{}_{}", adst, getpid(), tmpcounter++);
+}
+
+// the "native" CPU is resolved, so the cache directory can be shared between different machines
+static string TargetCpuKey()
+{
+  if ("native" != g_opt.target_cpu)
+  {
+    return std::format("{} {}", g_opt.target_cpu, g_opt.target_features);
+  }
+
+  vector<string> features;  // the StringMap order is not defined
+  for (auto & feat : llvm::sys::getHostCPUFeatures())
+  {
+    features.push_back((feat.second ? "+" : "-") + feat.first().str());
+  }
+  sort(features.begin(), features.end());
+
+  string result = llvm::sys::getHostCPUName().str();
+  for (const string & feat : features)
+  {
+    result += " " + feat;
+  }
+  return result + " " + g_opt.target_features;
+}
+
+// writes to a temporary file first, so the parallel compilers never see partial entries
+static bool AtomicCopy(const string & asrc, const string & adst)
+{
+  string tmpname = TempFileName(adst);
+  error_code ec;
+  fs::copy_file(asrc, tmpname, fs::copy_options::overwrite_existing, ec);
+  if (!ec)
+  {
+    fs::rename(tmpname, adst, ec);
+  }
+  if (ec)
+  {
+    fs::remove(tmpname, ec);
+    return false;
+  }
+  return true;
+}
+
+string CompCacheBaseDir()
+{
+  const char * xdg = getenv("XDG_CACHE_HOME");
+  const char * home = getenv("HOME");
+  if (xdg and *xdg)
+  {
+    return string(xdg) + "/dq-comp";
+  }
+  else if (home and *home)
+  {
+    return string(home) + "/.cache/dq-comp";
+  }
+  return "";
+}
+
+OCompCache::OCompCache()
+{
+  dir = g_opt.cache_dir;
+  if (dir.empty())
+  {
+    string basedir = CompCacheBaseDir();
+    if (!basedir.empty())
+    {
+      dir = basedir + "/objcache";
+    }
+  }
+}
+
+OCompCache::~OCompCache()
+{
+}
+
+bool OCompCache::Lookup(OScFile * amainfile, const string & aobjfilename)
+{
+  if (dir.empty())
+  {
+    ++misses;
+    return false;
+  }
+
+  // everything that changes the generated object
+  string keytext = std::format("dq-comp {}\nO{} g{} lto{} bc{} fm{} fpc{} iovf{} cgt{}\ncpu {}\n", DQ_COMPILER_VERSION,
+                               g_opt.optlevel, int(g_opt.dbg_info), int(g_opt.lto), int(g_opt.bounds_check),
+                               int(g_opt.fast_math), g_opt.fp_contract, g_opt.int_overflow, g_opt.codegen_threads,
+                               TargetCpuKey());
+  for (const OCmdLineDefine & def : g_opt.cmdline_defines)
+  {
+    keytext += std::format("D{} {}{} {}{}\n", def.name, int(def.has_bool_value), int(def.bool_value),
+                           int(def.has_int_value), def.int_value);
+  }
+  keytext += std::format("{}\n", amainfile->name);
+  if (g_opt.dbg_info)
+  {
+    // the debug info embeds the compile directory and the source paths relative to it
+    error_code ec;
+    keytext += std::format("cwd {}\n", fs::current_path(ec).string());
+  }
+  keytext += amainfile->Text();
+  basekey = HashText(keytext);
+
+  bool            manifest_main = false;
+  vector<string>  manifest_libs;
+  string          objkey;
+
+  ifstream mf(ManifestFileName());
+  string line;
+  bool valid = bool(mf);
+  while (valid and getline(mf, line))
+  {
+    if (line.starts_with("main "))
+    {
+      manifest_main = ("1" == line.substr(5));
+    }
+    else if (line.starts_with("lib "))
+    {
+      manifest_libs.push_back(line.substr(4));
+    }
+    else if (line.starts_with("obj "))
+    {
+      objkey = line.substr(4);
+    }
+    else if (line.starts_with("dep "))  // dep <hash> <fullpath>
+    {
+      size_t sp = line.find(' ', 4);
+      string deptext;
+      if ((sp == string::npos) or !ReadFileText(line.substr(sp + 1), deptext)
+          or (HashText(deptext) != line.substr(4, sp - 4)))
+      {
+        valid = false;  // an include file was changed
+      }
+    }
+  }
+
+  if (!valid or objkey.empty() or !AtomicCopy(ObjectFileName(objkey), aobjfilename))
+  {
+    ++misses;
+    if (g_opt.verblevel >= VERBLEVEL_INFO)
+    {
+      print("Object cache miss: \"{}\"\n", amainfile->name);
+    }
+    return false;
+  }
+
+  // the last use time is the modification time, the Trim() removes the oldest ones first
+  error_code ec;
+  fs::last_write_time(ObjectFileName(objkey), fs::file_time_type::clock::now(), ec);
+
+  has_main = manifest_main;
+  link_libraries = manifest_libs;
+  ++hits;
+  if (g_opt.verblevel >= VERBLEVEL_INFO)
+  {
+    print("Object cache hit: \"{}\"\n", amainfile->name);
+  }
+  return true;
+}
+
+void OCompCache::Store(const vector<OScFile *> & afiles, const string & aobjfilename, bool ahas_main,
+                       const vector<string> & alibraries)
+{
+  if (dir.empty() or basekey.empty())
+  {
+    return;
+  }
+
+  error_code ec;
+  fs::create_directories(dir, ec);
+  if (ec)
+  {
+    return;
+  }
+
+  // afiles[0] is the main file, it is already covered by the base key
+  string manifest = std::format("main {}\n", int(ahas_main));
+  string objkeytext = basekey;
+  for (size_t i = 1; i < afiles.size(); ++i)
+  {
+    string dephash = HashText(string(afiles[i]->Text()));
+    string fullpath = fs::absolute(afiles[i]->fullpath, ec).lexically_normal().string();
+    manifest += std::format("dep {} {}\n", dephash, fullpath);
+    objkeytext += "\n" + dephash;
+  }
+  for (const string & libname : alibraries)
+  {
+    manifest += std::format("lib {}\n", libname);
+  }
+  string objkey = HashText(objkeytext);
+  manifest += std::format("obj {}\n", objkey);
+
+  if (!AtomicCopy(aobjfilename, ObjectFileName(objkey)))
+  {
+    return;
+  }
+
+  string tmpname = TempFileName(ManifestFileName());
+  {
+    ofstream f(tmpname);
+    f << manifest;
+  }
+  fs::rename(tmpname, ManifestFileName(), ec);
+
+  Trim();
+}
+
+// the object key of a manifest, "" when it has none
+static string ManifestObjKey(const fs::path & apath)
+{
+  ifstream mf(apath);
+  string line;
+  while (getline(mf, line))
+  {
+    if (line.starts_with("obj "))
+    {
+      return line.substr(4);
+    }
+  }
+  return "";
+}
+
+void OCompCache::Trim()
+{
+  // an object and the manifests pointing to it form one entry, the last use time is the object's
+  struct SCacheEntry
+  {
+    fs::path             objpath;
+    vector<fs::path>     manifests;
+    uintmax_t            size = 0;
+    fs::file_time_type   mtime;
+  };
+
+  map<string, SCacheEntry>  entries;  // by object key
+  uintmax_t                 total = 0;
+  error_code                ec;
+  for (const fs::directory_entry & de : fs::directory_iterator(dir, ec))
+  {
+    if (!de.is_regular_file(ec))
+    {
+      continue;
+    }
+
+    SCacheEntry * ce;
+    if (de.path().extension() == ".o")
+    {
+      ce = &entries[de.path().stem().string()];
+      ce->objpath = de.path();
+      ce->mtime = de.last_write_time(ec);
+    }
+    else if (de.path().extension() == ".manifest")
+    {
+      ce = &entries[ManifestObjKey(de.path())];
+      ce->manifests.push_back(de.path());
+    }
+    else
+    {
+      continue;
+    }
+    uintmax_t fsize = de.file_size(ec);
+    ce->size += fsize;
+    total += fsize;
+  }
+
+  // the manifests without object would give only misses
+  vector<SCacheEntry *> objentries;
+  for (auto & [objkey, ce] : entries)
+  {
+    if (!ce.objpath.empty())
+    {
+      objentries.push_back(&ce);
+      continue;
+    }
+    for (const fs::path & mpath : ce.manifests)
+    {
+      fs::remove(mpath, ec);
+    }
+    total -= ce.size;
+  }
+
+  if (total <= g_opt.cache_size_limit)
+  {
+    return;
+  }
+
+  // the oldest entries are removed until 90% of the limit
+  sort(objentries.begin(), objentries.end(),
+    [](const SCacheEntry * a, const SCacheEntry * b)
+    {
+      return a->mtime < b->mtime;
+    }
+  );
+  for (const SCacheEntry * ce : objentries)
+  {
+    if (total <= g_opt.cache_size_limit / 10 * 9)
+    {
+      break;
+    }
+    for (const fs::path & mpath : ce->manifests)
+    {
+      fs::remove(mpath, ec);
+    }
+    fs::remove(ce->objpath, ec);
+    total -= ce->size;
+  }
+}
+
+void OCompCache::PrintStats()
+{
+  if (g_opt.use_cache and (g_opt.verblevel >= VERBLEVEL_STATUS))
+  {
+    print("Object cache: {} hits, {} misses\n", int(hits), int(misses));
+  }
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    dqc_cache.h
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   persistent object cache (-fcache), keyed by the source contents and the options
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include "stdint.h"
+
+#include "scf_base.h"
+
+using namespace std;
+
+/* The include files are known only after the parsing, so the lookup happens in two steps:
+     1. the base key (main file contents + options + compiler version) selects a manifest
+     2. the manifest lists the include files with their content hashes, when all of them
+        are unchanged, then the object stored under the full key is used
+*/
+
+class OCompCache
+{
+public:
+  string           dir;
+  string           basekey;            // set by Lookup()
+
+  // results of a successful lookup
+  bool             has_main = false;
+  vector<string>   link_libraries;
+
+  static atomic<int>  hits;            // process wide statistics
+  static atomic<int>  misses;
+
+public:
+  OCompCache();
+  virtual ~OCompCache();
+
+  bool Lookup(OScFile * amainfile, const string & aobjfilename);  // copies the object on hit
+  void Store(const vector<OScFile *> & afiles, const string & aobjfilename, bool ahas_main, const vector<string> & alibraries);
+
+  static void PrintStats();
+
+protected:
+  string ManifestFileName()  { return dir + "/" + basekey + ".manifest"; }
+  string ObjectFileName(const string & akey)  { return dir + "/" + akey + ".o"; }
+
+  void Trim();  // removes the oldest entries above the size limit
+};
+
+string CompCacheBaseDir();  // $XDG_CACHE_HOME/dq-comp or ~/.cache/dq-comp, "" = not available
@@ -169,6 +169,9 @@ void ODqCompClargs::ParseCmdLineArgsVerblevel(int argc, char ** argv)
 void ODqCompClargs::ParseCmdLineArgs(int argc, char ** argv)
 {
   string explicit_output;
+  string legacy_output;
+  int    posargcnt = 0;
+  bool   time_trace_default = false;
 
   for (int i = 1; i < argc; i++)
   {
@@ -177,6 +180,7 @@ void ODqCompClargs::ParseCmdLineArgs(int argc, char ** argv)
     if ('-' == v[0])  // some compiler switch
     {
       if      ("--version" == v)  g_opt.print_version = true;
+      else if ("--full-teardown" == v)  g_opt.full_teardown = true;
       else if (VerblevelSwitch(v))  { /* already handled in the function */ }
       else if ("-g"  == v)    g_opt.dbg_info = true;
       else if ("-ir" == v)    g_opt.ir_print = true;
@@ -229,6 +233,132 @@ void ODqCompClargs::ParseCmdLineArgs(int argc, char ** argv)
       else if ("-O1" == v)    g_opt.optlevel = 1;
       else if ("-O2" == v)    g_opt.optlevel = 2;
       else if ("-O3" == v)    g_opt.optlevel = 3;
+      else if ("-ftime-report" == v)  g_opt.time_report = true;
+      else if ("-fstats" == v)        g_opt.stats = true;
+      else if ("-ftime-trace" == v)   time_trace_default = true;
+      else if (v.starts_with("-ftime-trace="))
+      {
+        g_opt.time_trace_file = v.substr(13);
+        if (g_opt.time_trace_file.empty())
+        {
+          ++errorcnt;
+          print("Missing filename after -ftime-trace=\n");
+          PrintUsage();
+          return;
+        }
+      }
+      else if (v.starts_with("-fcodegen-threads="))
+      {
+        int64_t threads = 0;
+        if (!ParseDefineIntValue(v.substr(18), threads) or (threads < 1) or (threads > 1024))
+        {
+          ++errorcnt;
+          print("Invalid code generator thread count: {}\n", v);
+          PrintUsage();
+          return;
+        }
+        g_opt.codegen_threads = int(threads);
+      }
+      else if (("-flto" == v) or ("-flto=full" == v))
+      {
+        g_opt.lto = true;
+      }
+      else if ("-fno-lto" == v)
+      {
+        g_opt.lto = false;
+      }
+      else if ("-ffast-math" == v)         g_opt.fast_math = true;
+      else if ("-fno-fast-math" == v)      g_opt.fast_math = false;
+      else if ("-ffp-contract=off" == v)   g_opt.fp_contract = FPCONTRACT_OFF;
+      else if ("-ffp-contract=on" == v)    g_opt.fp_contract = FPCONTRACT_ON;
+      else if ("-ffp-contract=fast" == v)  g_opt.fp_contract = FPCONTRACT_FAST;
+      else if ("-fint-overflow=wrap" == v)  g_opt.int_overflow = INTOVF_WRAP;
+      else if ("-fint-overflow=nsw" == v)   g_opt.int_overflow = INTOVF_NSW;
+      else if ("-fint-overflow=trap" == v)  g_opt.int_overflow = INTOVF_TRAP;
+      else if ("-fbounds-check" == v)       g_opt.bounds_check = true;
+      else if ("-fno-bounds-check" == v)    g_opt.bounds_check = false;
+      else if ("-fno-mmap" == v)   g_opt.mmap_sources = false;
+      else if ("-fcache" == v)     g_opt.use_cache = true;
+      else if ("-fno-cache" == v)  g_opt.use_cache = false;
+      else if (v.starts_with("-fcache-dir="))
+      {
+        g_opt.cache_dir = v.substr(12);
+        g_opt.use_cache = !g_opt.cache_dir.empty();
+      }
+      else if (v.starts_with("-fcache-size="))
+      {
+        string sizestr = v.substr(13);
+        uint64_t mul = 1024 * 1024;  // megabytes by default
+        if (!sizestr.empty())
+        {
+          char c = sizestr.back();
+          if      (('K' == c) or ('k' == c))  mul = 1024;
+          else if (('M' == c) or ('m' == c))  mul = 1024 * 1024;
+          else if (('G' == c) or ('g' == c))  mul = 1024 * 1024 * 1024;
+          if ((c < '0') or (c > '9'))  sizestr.pop_back();
+        }
+        int64_t size = 0;
+        if (!ParseDefineIntValue(sizestr, size) or (size < 1))
+        {
+          ++errorcnt;
+          print("Invalid cache size: {}\n", v);
+          PrintUsage();
+          return;
+        }
+        g_opt.cache_size_limit = uint64_t(size) * mul;
+      }
+      else if (v.starts_with("-fuse-ld="))
+      {
+        g_opt.linker = v.substr(9);
+      }
+      else if ("-march=native" == v)
+      {
+        g_opt.target_cpu = "native";
+      }
+      else if (v.starts_with("-mcpu="))
+      {
+        g_opt.target_cpu = v.substr(6);
+        if (g_opt.target_cpu.empty())
+        {
+          ++errorcnt;
+          print("Missing CPU name after -mcpu=\n");
+          PrintUsage();
+          return;
+        }
+      }
+      else if (v.starts_with("-mattr="))
+      {
+        if (!g_opt.target_features.empty())
+        {
+          g_opt.target_features += ",";
+        }
+        g_opt.target_features += v.substr(7);
+      }
+      else if ((v.size() > 2) and ('j' == v[1]))  // -j<n>
+      {
+        int64_t jobs = 0;
+        if (!ParseDefineIntValue(v.substr(2), jobs) or (jobs < 1) or (jobs > 1024))
+        {
+          ++errorcnt;
+          print("Invalid job count: {}\n", v);
+          PrintUsage();
+          return;
+        }
+        g_opt.jobs = int(jobs);
+      }
+      else if ("-j" == v)
+      {
+        int64_t jobs = 0;
+        if ((i + 1 >= argc) or !ParseDefineIntValue(argv[i + 1], jobs) or (jobs < 1) or (jobs > 1024))
+        {
+          ++errorcnt;
+          print("Missing or invalid job count after -j\n");
+          PrintUsage();
+          return;
+        }
+        ++i;
+        g_opt.jobs = int(jobs);
+      }
       else if ("-o"  == v)
       {
         if (i + 1 < argc)
@@ -256,12 +386,24 @@ void ODqCompClargs::ParseCmdLineArgs(int argc, char ** argv)
     else if (in_filename.empty())
     {
       in_filename = v;
+      in_filenames.push_back(v);
+      ++posargcnt;
     }
-    else if (!has_dash_o)
+    else if (v.ends_with(".dq"))
     {
-      // backward compatibility: second positional arg = output name
-      explicit_output = v;
-      has_dash_o = true;
+      in_filenames.push_back(v);
+      ++posargcnt;
+    }
+    else if ((1 == posargcnt) and !has_dash_o)
+    {
+      // backward compatibility: second positional arg = output name, resolved after the -o
+      legacy_output = v;
+      ++posargcnt;
+    }
+    else if (v.ends_with(".o") or v.ends_with(".bc"))
+    {
+      in_objects.push_back(v);
+      ++posargcnt;
     }
     else
     {
@@ -277,6 +419,27 @@ void ODqCompClargs::ParseCmdLineArgs(int argc, char ** argv)
     return;
   }
 
+  if (!legacy_output.empty())
+  {
+    if (!has_dash_o)
+    {
+      explicit_output = legacy_output;
+      has_dash_o = true;
+    }
+    else if (legacy_output.ends_with(".o") or legacy_output.ends_with(".bc"))
+    {
+      // the -o names the output, so this is an input object
+      in_objects.insert(in_objects.begin(), legacy_output);
+    }
+    else
+    {
+      ++errorcnt;
+      print("Unexpected argument: {}\n", legacy_output);
+      PrintUsage();
+      return;
+    }
+  }
+
   if (in_filename.empty())
   {
     ++errorcnt;
@@ -285,25 +448,50 @@ void ODqCompClargs::ParseCmdLineArgs(int argc, char ** argv)
     return;
   }
 
-  // derive base_name by stripping .dq extension
-  if (in_filename.size() > 3 && in_filename.substr(in_filename.size() - 3) == ".dq")
+  if ((in_filenames.size() > 1) and g_opt.compile_only and has_dash_o)
   {
-    base_name = in_filename.substr(0, in_filename.size() - 3);
+    ++errorcnt;
+    print("Cannot use -o with -c and multiple input files\n");
+    return;
   }
-  else
+
+  if ((in_filenames.size() > 1) and g_opt.jit_run)
+  {
+    ++errorcnt;
+    print("Only one input file is supported in JIT mode\n");
+    return;
+  }
+
+  if (!in_objects.empty() and g_opt.compile_only)
+  {
+    ++errorcnt;
+    print("Object file inputs can not be used with -c\n");
+    return;
+  }
+
+  if (!in_objects.empty() and g_opt.jit_run)
+  {
+    ++errorcnt;
+    print("Object file inputs are not supported in JIT mode\n");
+    return;
+  }
+
+  base_name = BaseName(in_filename);
+
+  if (time_trace_default and g_opt.time_trace_file.empty())
   {
-    base_name = in_filename;
+    g_opt.time_trace_file = base_name + ".time.json";
   }
 
   if (g_opt.compile_only)
   {
     // -c: compile only, no linking
-    out_filename = has_dash_o ? explicit_output : base_name + ".o";
+    out_filename = has_dash_o ? explicit_output : ObjFileName(in_filename);
   }
   else
   {
     // object file always goes to base_name.o
-    out_filename = base_name + ".o";
+    out_filename = ObjFileName(in_filename);
     // link_output is where the final result should go
     link_output = has_dash_o ? explicit_output : base_name;
   }
@@ -311,19 +499,55 @@ void ODqCompClargs::ParseCmdLineArgs(int argc, char ** argv)
   return;
 }
 
+string ODqCompClargs::BaseName(const string & afilename)
+{
+  // derive base_name by stripping .dq extension
+  if (afilename.size() > 3 && afilename.substr(afilename.size() - 3) == ".dq")
+  {
+    return afilename.substr(0, afilename.size() - 3);
+  }
+  return afilename;
+}
+
+string ODqCompClargs::ObjFileName(const string & afilename)
+{
+  return BaseName(afilename) + ".o";
+}
 
 void ODqCompClargs::PrintUsage()
 {
   print("Usage:\n");
   print("  dq-comp [options] <file.dq>\n");
+  print("  dq-comp [options] <file1.dq> <file2.dq> ...\n");
+  print("  dq-comp [options] -o <output> <file.dq> ... <obj.o> <lto.bc> ... : the .o/.bc inputs are linked to the program\n");
+  print("  dq-comp [options] <file.dq> <output> : legacy form, the second argument is the output name\n");
   print("Options:\n");
   print("  -o <file> : set output filename\n");
   print("  -c        : compile only (do not link)\n");
   print("  --version : print compiler version\n");
+  print("  --full-teardown : destroy the compiler state before exiting (for leak checking)\n");
   print("  -D<name>  : defines the <name> symbol with boolean true\n");
   print("  -D<name>=<value> : defines the <name> symbol with the <value> (int/bool)\n");
   print("  -On       : optimization level, n=0-3\n");
+  print("  -j <n>    : number of parallel compile jobs for multiple input files (default: CPU count)\n");
+  print("  -march=native : generate code for the host CPU (and its features)\n");
+  print("  -mcpu=<name>  : generate code for the given CPU (\"native\" = host CPU)\n");
+  print("  -mattr=<+f1,-f2,...> : enable/disable target features\n");
+  print("  -fcodegen-threads=<n> : split the module into <n> partitions for parallel code generation\n");
+  print("  -flto     : link time optimization: bitcode objects, whole program optimization when linking\n");
+  print("  -ffast-math : allow unsafe floating point optimizations (reassociation, no NaN/Inf)\n");
+  print("  -ffp-contract=<off|on|fast> : fused multiply-add: off (default), within expressions, everywhere\n");
+  print("  -fint-overflow=<wrap|nsw|trap> : integer +,-,* overflow: wrap around (default), undefined, trap\n");
+  print("  -fbounds-check : check the array, slice and cstring indexes at runtime, report file:line and trap\n");
+  print("  -fno-mmap : read the source files into memory instead of mapping them\n");
+  print("  -fcache   : use the persistent object cache (~/.cache/dq-comp/objcache)\n");
+  print("  -fcache-dir=<dir> : use the object cache in <dir>\n");
+  print("  -fcache-size=<n>[K|M|G] : object cache size limit (default: 256M)\n");
+  print("  -fuse-ld=<ld> : linker to use: bfd, gold, lld, mold, <path> or gcc (gcc driver)\n");
   print("  -g        : generate debug info\n");
+  print("  -ftime-report : print compilation phase and LLVM pass timings\n");
+  print("  -ftime-trace[=<file>] : write Chrome trace JSON (default: <name>.time.json)\n");
+  print("  -fstats   : print the AST/symbol allocation statistics and the peak memory\n");
   print("  -v,-v1    : print compile status messages\n");
   print("  -vv,-v2   : print detailed compiler information\n");
   print("  -vvv,-v3  : print compiler internal trace messages\n");
@@ -15,6 +15,7 @@
 
 #include "stdint.h"
 #include <string>
+#include <vector>
 #include "comp_options.h"
 
 #include "dqc_codegen.h"
@@ -27,7 +28,9 @@ private:
   using            super = ODqCompCodegen;
 
 public:
-  string           in_filename = "";
+  string           in_filename = "";   // the (first) input file
+  vector<string>   in_filenames;       // all input files
+  vector<string>   in_objects;         // .o and .bc (-flto) input files, passed to the linker
   string           out_filename = "";  // object file path (.o)
   string           base_name = "";     // in_filename with .dq stripped
   string           link_output = "";   // final executable/output name
@@ -42,6 +45,9 @@ public:
 
   void PrintUsage();
 
+  static string BaseName(const string & afilename);  // strips the .dq extension
+  static string ObjFileName(const string & afilename);
+
 protected:
   bool VerblevelSwitch(const string & aswitch);
 
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    dqc_idents.cpp
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   compiler-wide identifier interning and id keyed symbol tables
+ */
+
+#include "string.h"
+
+#include <algorithm>
+
+#include "dqc_idents.h"
+#include "dqc_keywords.h"
+
+thread_local OIdentTable  g_idents;
+
+OIdentTable::OIdentTable()
+{
+  slots.assign(1024, -1);
+
+  // the keywords get the first ids, in the EKeyword order (see the KeywordOfId())
+  for (const TKeywordDef & kd : dq_keyword_defs)
+  {
+    Intern(kd.name);
+  }
+}
+
+uint32_t OIdentTable::Hash(const char * astr, uint32_t alen)
+{
+  // FNV-1a
+  uint32_t h = 2166136261u;
+  for (uint32_t i = 0; i < alen; ++i)
+  {
+    h = (h ^ uint8_t(astr[i])) * 16777619u;
+  }
+  return h;
+}
+
+int32_t OIdentTable::FindSlot(const char * astr, uint32_t alen, uint32_t ahash)
+{
+  uint32_t mask = slots.size() - 1;
+  uint32_t si = ahash & mask;
+  while (true)
+  {
+    int32_t id = slots[si];
+    if ((id < 0)
+        or ((hashes[id] == ahash) and (names[id].size() == alen) and (0 == memcmp(names[id].data(), astr, alen))))
+    {
+      return si;
+    }
+    si = (si + 1) & mask;
+  }
+}
+
+int32_t OIdentTable::Find(string_view aname)
+{
+  return slots[FindSlot(aname.data(), aname.size(), Hash(aname.data(), aname.size()))];
+}
+
+int32_t OIdentTable::Intern(const char * astr, uint32_t alen)
+{
+  uint32_t h = Hash(astr, alen);
+  int32_t si = FindSlot(astr, alen, h);
+  if (slots[si] >= 0)
+  {
+    return slots[si];
+  }
+
+  // new name, copy the text into the chunk storage
+  if (alen > chunkfree)
+  {
+    chunkfree = max(alen, 65536u);
+    chunks.emplace_back(new char[chunkfree]);
+    chunkp = chunks.back().get();
+  }
+  memcpy(chunkp, astr, alen);
+
+  int32_t id = names.size();
+  names.emplace_back(chunkp, alen);
+  hashes.push_back(h);
+  chunkp += alen;
+  chunkfree -= alen;
+
+  slots[si] = id;
+  if (names.size() * 2 > slots.size())  // keep the load factor under 50%
+  {
+    Rehash();
+  }
+  return id;
+}
+
+void OIdentTable::Rehash()
+{
+  slots.assign(slots.size() * 2, -1);
+  uint32_t mask = slots.size() - 1;
+  for (int32_t id = 0; id < int32_t(names.size()); ++id)
+  {
+    uint32_t si = hashes[id] & mask;
+    while (slots[si] >= 0)
+    {
+      si = (si + 1) & mask;
+    }
+    slots[si] = id;
+  }
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    dqc_idents.h
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   compiler-wide identifier interning and id keyed symbol tables
+ */
+
+#pragma once
+
+#include <string_view>
+#include <vector>
+#include <memory>
+#include "stdint.h"
+
+using namespace std;
+
+// Every distinct identifier text gets a stable id, the texts are stored only once
+class OIdentTable
+{
+public:
+  vector<string_view>  names;   // indexed by the id
+
+  OIdentTable();
+
+  int32_t Intern(const char * astr, uint32_t alen);
+  inline int32_t Intern(string_view aname)  { return Intern(aname.data(), aname.size()); }
+  int32_t Find(string_view aname);  // returns -1 when the name was not interned yet
+
+  inline string_view Name(int32_t aid)  { return names[aid]; }
+  inline int Count()  { return names.size(); }
+
+protected:
+  vector<int32_t>           slots;     // open addressing with linear probing, -1 = free
+  vector<uint32_t>          hashes;    // hash of the names, indexed by the id
+  vector<unique_ptr<char[]>>  chunks;  // storage of the name texts
+  char *                    chunkp = nullptr;
+  uint32_t                  chunkfree = 0;
+
+  static uint32_t Hash(const char * astr, uint32_t alen);
+  int32_t FindSlot(const char * astr, uint32_t alen, uint32_t ahash);
+  void Rehash();
+};
+
+extern thread_local OIdentTable  g_idents;
+
+// Open addressing hash table keyed by the interned identifier ids, used for the scope symbol tables
+template <class T>
+class OIdentMap
+{
+public:
+  T * Find(int32_t aid) const
+  {
+    if (0 == count)
+    {
+      return nullptr;
+    }
+
+    uint32_t mask = slots.size() - 1;
+    for (uint32_t si = SlotHash(aid) & mask; ; si = (si + 1) & mask)
+    {
+      const SSlot & slot = slots[si];
+      if (slot.id == aid)
+      {
+        return slot.value;
+      }
+      if (slot.id < 0)
+      {
+        return nullptr;
+      }
+    }
+  }
+
+  T * Add(int32_t aid, T * avalue)  // returns the already stored value, or nullptr when the new one was added
+  {
+    if ((count + 1) * 4 > slots.size() * 3)  // keep the load factor under 75%
+    {
+      Grow();
+    }
+
+    uint32_t mask = slots.size() - 1;
+    uint32_t si = SlotHash(aid) & mask;
+    while (slots[si].id >= 0)
+    {
+      if (slots[si].id == aid)
+      {
+        return slots[si].value;
+      }
+      si = (si + 1) & mask;
+    }
+
+    slots[si].id = aid;
+    slots[si].value = avalue;
+    ++count;
+    return nullptr;
+  }
+
+  inline uint32_t Count() const  { return count; }
+
+protected:
+  struct SSlot
+  {
+    int32_t  id = -1;
+    T *      value = nullptr;
+  };
+
+  vector<SSlot>  slots;
+  uint32_t       count = 0;
+
+  static inline uint32_t SlotHash(int32_t aid)  { return uint32_t(aid) * 2654435761u; }
+
+  void Grow()
+  {
+    vector<SSlot> oldslots;
+    oldslots.swap(slots);
+    slots.resize(oldslots.empty() ? 8 : oldslots.size() * 2);
+
+    uint32_t mask = slots.size() - 1;
+    for (SSlot & slot : oldslots)
+    {
+      if (slot.id >= 0)
+      {
+        uint32_t si = SlotHash(slot.id) & mask;
+        while (slots[si].id >= 0)
+        {
+          si = (si + 1) & mask;
+        }
+        slots[si] = slot;
+      }
+    }
+  }
+};
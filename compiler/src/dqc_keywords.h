@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    dqc_keywords.h
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   keyword table with a compile-time generated perfect hash
+ */
+
+#pragma once
+
+#include <string_view>
+#include <array>
+#include "stdint.h"
+
+using namespace std;
+
+enum EKeyword : uint8_t
+{
+  KW_NONE = 0,   // ordinary identifier
+
+  // declarations and statements
+  KW_VAR,
+  KW_CONST,
+  KW_TYPE,
+  KW_REF,
+  KW_REFIN,
+  KW_REFOUT,
+  KW_REFNULL,
+  KW_FOR,
+  KW_WHILE,
+  KW_IF,
+  KW_ELSE,
+  KW_ELIF,
+  KW_ENDIF,
+  KW_RETURN,
+  KW_BREAK,
+  KW_CONTINUE,
+  KW_FUNCTION,
+  KW_USE,
+  KW_IMPLEMENTATION,
+  KW_INITIALIZATION,
+  KW_FINALIZATION,
+  KW_STRUCT,
+  KW_ENDSTRUCT,
+  KW_OBJECT,
+  KW_ENDOBJ,
+  KW_NULL,
+
+  // block closers and words of the statements, these are not reserved
+  KW_ENDFUNC,
+  KW_ENDWHILE,
+  KW_ENDFOR,
+  KW_OF,
+  KW_TRUE,
+  KW_FALSE,
+
+  // operators
+  KW_AND,
+  KW_NOT,
+  KW_OR,
+  KW_BIN_NOT,
+  KW_BIN_AND,
+  KW_BIN_OR,
+  KW_BIN_XOR,
+  KW_IDIV,
+  KW_IMOD,
+  KW_SHL,
+  KW_SHR,
+
+  // builtin functions, these are not reserved
+  KW_LEN,
+  KW_IIF,
+  KW_SIZEOF,
+  KW_ROUND,
+  KW_CEIL,
+  KW_FLOOR,
+  KW_VLOAD,
+  KW_VSTORE,
+  KW_VSHUFFLE,
+  KW_VSELECT,
+  KW_VREDUCE_ADD,
+  KW_VREDUCE_MUL,
+  KW_VREDUCE_MIN,
+  KW_VREDUCE_MAX,
+  KW_VANY,
+  KW_VALL,
+
+  KW_COUNT
+};
+
+enum EKeywordFlag : uint8_t
+{
+  KWF_RESERVED  = 0x01,  // can not be used as an identifier
+  KWF_ROOT      = 0x02,  // starts a module root statement
+  KWF_BUILTIN   = 0x04   // builtin function
+};
+
+struct TKeywordDef
+{
+  string_view  name;
+  EKeyword     kw;
+  uint8_t      flags;
+};
+
+inline constexpr TKeywordDef dq_keyword_defs[] =
+{
+  { "var",             KW_VAR,             KWF_RESERVED | KWF_ROOT },
+  { "const",           KW_CONST,           KWF_ROOT },
+  { "type",            KW_TYPE,            KWF_ROOT },
+  { "ref",             KW_REF,             KWF_RESERVED },
+  { "refin",           KW_REFIN,           KWF_RESERVED },
+  { "refout",          KW_REFOUT,          KWF_RESERVED },
+  { "refnull",         KW_REFNULL,         KWF_RESERVED },
+  { "for",             KW_FOR,             KWF_RESERVED },
+  { "while",           KW_WHILE,           KWF_RESERVED },
+  { "if",              KW_IF,              KWF_RESERVED },
+  { "else",            KW_ELSE,            KWF_RESERVED },
+  { "elif",            KW_ELIF,            0 },
+  { "endif",           KW_ENDIF,           0 },
+  { "return",          KW_RETURN,          KWF_RESERVED },
+  { "break",           KW_BREAK,           KWF_RESERVED },
+  { "continue",        KW_CONTINUE,        KWF_RESERVED },
+  { "function",        KW_FUNCTION,        KWF_RESERVED | KWF_ROOT },
+  { "use",             KW_USE,             KWF_RESERVED | KWF_ROOT },
+  { "implementation",  KW_IMPLEMENTATION,  KWF_RESERVED | KWF_ROOT },
+  { "initialization",  KW_INITIALIZATION,  KWF_RESERVED | KWF_ROOT },
+  { "finalization",    KW_FINALIZATION,    KWF_RESERVED | KWF_ROOT },
+  { "struct",          KW_STRUCT,          KWF_RESERVED | KWF_ROOT },
+  { "endstruct",       KW_ENDSTRUCT,       KWF_RESERVED },
+  { "object",          KW_OBJECT,          KWF_RESERVED | KWF_ROOT },
+  { "endobj",          KW_ENDOBJ,          KWF_RESERVED },
+  { "null",            KW_NULL,            KWF_RESERVED },
+
+  { "endfunc",         KW_ENDFUNC,         0 },
+  { "endwhile",        KW_ENDWHILE,        0 },
+  { "endfor",          KW_ENDFOR,          0 },
+  { "of",              KW_OF,              0 },
+  { "true",            KW_TRUE,            0 },
+  { "false",           KW_FALSE,           0 },
+
+  { "and",             KW_AND,             KWF_RESERVED },
+  { "not",             KW_NOT,             KWF_RESERVED },
+  { "or",              KW_OR,              KWF_RESERVED },
+  { "NOT",             KW_BIN_NOT,         KWF_RESERVED },
+  { "AND",             KW_BIN_AND,         KWF_RESERVED },
+  { "OR",              KW_BIN_OR,          KWF_RESERVED },
+  { "XOR",             KW_BIN_XOR,         KWF_RESERVED },
+  { "IDIV",            KW_IDIV,            KWF_RESERVED },
+  { "IMOD",            KW_IMOD,            KWF_RESERVED },
+  { "SHL",             KW_SHL,             0 },
+  { "SHR",             KW_SHR,             0 },
+
+  { "len",             KW_LEN,             KWF_BUILTIN },
+  { "iif",             KW_IIF,             KWF_BUILTIN },
+  { "sizeof",          KW_SIZEOF,          KWF_BUILTIN },
+  { "round",           KW_ROUND,           KWF_BUILTIN },
+  { "ceil",            KW_CEIL,            KWF_BUILTIN },
+  { "floor",           KW_FLOOR,           KWF_BUILTIN },
+  { "vload",           KW_VLOAD,           KWF_BUILTIN },
+  { "vstore",          KW_VSTORE,          KWF_BUILTIN },
+  { "vshuffle",        KW_VSHUFFLE,        KWF_BUILTIN },
+  { "vselect",         KW_VSELECT,         KWF_BUILTIN },
+  { "vreduce_add",     KW_VREDUCE_ADD,     KWF_BUILTIN },
+  { "vreduce_mul",     KW_VREDUCE_MUL,     KWF_BUILTIN },
+  { "vreduce_min",     KW_VREDUCE_MIN,     KWF_BUILTIN },
+  { "vreduce_max",     KW_VREDUCE_MAX,     KWF_BUILTIN },
+  { "vany",            KW_VANY,            KWF_BUILTIN },
+  { "vall",            KW_VALL,            KWF_BUILTIN },
+};
+
+//-----------------------------------------------------------------------------
+// Perfect hash: the seed is searched at compile time, so that every keyword gets
+// its own slot. A lookup hashes the name once and does a single compare.
+
+inline constexpr unsigned dq_keyword_slots = 512;  // power of two, sparse enough to find a seed quickly
+
+constexpr uint32_t KeywordHash(uint32_t aseed, string_view aname)
+{
+  uint32_t h = aseed ^ uint32_t(aname.size());
+  for (char c : aname)
+  {
+    h = (h ^ uint8_t(c)) * 16777619u;
+  }
+  return (h ^ (h >> 15)) & (dq_keyword_slots - 1);
+}
+
+constexpr bool KeywordSeedOk(uint32_t aseed)
+{
+  array<bool, dq_keyword_slots> used {};
+  for (const TKeywordDef & kd : dq_keyword_defs)
+  {
+    uint32_t slot = KeywordHash(aseed, kd.name);
+    if (used[slot])
+    {
+      return false;
+    }
+    used[slot] = true;
+  }
+  return true;
+}
+
+constexpr uint32_t KeywordFindSeed()
+{
+  for (uint32_t seed = 2166136261u; ; ++seed)
+  {
+    if (KeywordSeedOk(seed))
+    {
+      return seed;
+    }
+  }
+}
+
+inline constexpr uint32_t dq_keyword_seed = KeywordFindSeed();
+
+constexpr array<int8_t, dq_keyword_slots> KeywordBuildSlots()
+{
+  array<int8_t, dq_keyword_slots> result {};
+  for (int8_t & s : result)
+  {
+    s = -1;
+  }
+  for (unsigned i = 0; i < size(dq_keyword_defs); ++i)
+  {
+    result[KeywordHash(dq_keyword_seed, dq_keyword_defs[i].name)] = i;
+  }
+  return result;
+}
+
+inline constexpr array<int8_t, dq_keyword_slots> dq_keyword_slot_table = KeywordBuildSlots();
+
+inline constexpr unsigned dq_keyword_maxlen = 14;  // "implementation", "initialization"
+
+constexpr bool KeywordDefsValid()
+{
+  for (unsigned i = 0; i < size(dq_keyword_defs); ++i)
+  {
+    if ((dq_keyword_defs[i].kw != i + 1) or (dq_keyword_defs[i].name.size() > dq_keyword_maxlen))
+    {
+      return false;
+    }
+  }
+  return (size(dq_keyword_defs) == KW_COUNT - 1);
+}
+
+static_assert(KeywordDefsValid(), "the dq_keyword_defs must follow the EKeyword order");
+
+// returns the keyword definition or nullptr for the ordinary identifiers
+constexpr const TKeywordDef * FindKeyword(string_view aname)
+{
+  if (aname.size() > dq_keyword_maxlen)
+  {
+    return nullptr;
+  }
+  int8_t idx = dq_keyword_slot_table[KeywordHash(dq_keyword_seed, aname)];
+  if ((idx < 0) or (dq_keyword_defs[idx].name != aname))
+  {
+    return nullptr;
+  }
+  return &dq_keyword_defs[idx];
+}
+
+constexpr EKeyword KeywordOf(string_view aname)
+{
+  const TKeywordDef * kd = FindKeyword(aname);
+  return (kd ? kd->kw : KW_NONE);
+}
+
+// The OIdentTable interns the keywords first, in the EKeyword order: the interned id of a keyword
+// is its EKeyword - 1. The parser compares the token ids directly with these.
+constexpr int32_t KeywordIdentId(EKeyword akw)
+{
+  return int32_t(akw) - 1;
+}
+
+constexpr EKeyword KeywordOfId(int32_t aidentid)
+{
+  return (uint32_t(aidentid) < uint32_t(KW_COUNT - 1) ? EKeyword(aidentid + 1) : KW_NONE);
+}
+
+constexpr string_view KeywordName(EKeyword akw)
+{
+  return dq_keyword_defs[akw - 1].name;
+}
+
+constexpr uint8_t KeywordFlags(EKeyword akw)
+{
+  return (KW_NONE == akw ? 0 : dq_keyword_defs[akw - 1].flags);
+}
+
+static_assert(KeywordOf("function") == KW_FUNCTION);
+static_assert(KeywordOf("IMOD") == KW_IMOD);
+static_assert(KeywordOf("imod") == KW_NONE);
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    dqc_link.cpp
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   link driver: calls the system linker directly (without shell and gcc)
+ */
+
+#include <print>
+#include <format>
+#include <fstream>
+#include <filesystem>
+#include <cstdlib>
+#include <unistd.h>
+
+#include "dqc_link.h"
+#include "comp_options.h"
+#include "processrunner.h"
+#include "version.h"
+#include "dqc_cache.h"
+
+namespace fs = std::filesystem;
+
+#if defined(__x86_64__)
+  #define LINK_MULTIARCH       "x86_64-linux-gnu"
+  #define LINK_DYNAMIC_LINKER  "/lib64/ld-linux-x86-64.so.2"
+#elif defined(__aarch64__)
+  #define LINK_MULTIARCH       "aarch64-linux-gnu"
+  #define LINK_DYNAMIC_LINKER  "/lib/ld-linux-aarch64.so.1"
+#elif defined(__riscv) && (__riscv_xlen == 64)
+  #define LINK_MULTIARCH       "riscv64-linux-gnu"
+  #define LINK_DYNAMIC_LINKER  "/lib/ld-linux-riscv64-lp64d.so.1"
+#else
+  #define LINK_MULTIARCH       ""
+  #define LINK_DYNAMIC_LINKER  ""
+#endif
+
+static bool FileExists(const string & afilename)
+{
+  error_code ec;
+  return fs::is_regular_file(afilename, ec);
+}
+
+// returns the directory of the first candidate containing all of the given files
+static string FindDirWith(const vector<string> & adirs, const vector<string> & afiles)
+{
+  for (const string & dir : adirs)
+  {
+    bool found = true;
+    for (const string & fname : afiles)
+    {
+      if (!FileExists(dir + "/" + fname))
+      {
+        found = false;
+        break;
+      }
+    }
+    if (found)
+    {
+      return dir;
+    }
+  }
+  return "";
+}
+
+OLinkDriver::OLinkDriver()
+{
+}
+
+OLinkDriver::~OLinkDriver()
+{
+}
+
+void OLinkDriver::SetLinker(const string & afuseld)
+{
+  use_gcc = false;
+  if (afuseld.empty() or ("ld" == afuseld))
+  {
+    linker = "ld";
+  }
+  else if ("gcc" == afuseld)
+  {
+    use_gcc = true;
+    linker = "gcc";
+  }
+  else if (afuseld.find('/') != string::npos)
+  {
+    linker = afuseld;  // full path
+  }
+  else
+  {
+    linker = "ld." + afuseld;  // bfd, gold, lld, mold
+  }
+}
+
+bool OLinkDriver::Link(const vector<string> & aobjects, const vector<string> & alibraries, const string & aoutput)
+{
+  // the bitcode objects (-flto) are merged and compiled to a single native object first
+  vector<string> objects;
+  vector<string> bcobjects;
+  for (const string & obj : aobjects)
+  {
+    if (IsBitcodeFile(obj))
+    {
+      bcobjects.push_back(obj);
+    }
+    else
+    {
+      objects.push_back(obj);
+    }
+  }
+
+  if (bcobjects.empty())
+  {
+    return LinkNative(objects, alibraries, aoutput);
+  }
+
+  string ltoobj = aoutput + ".lto.o";
+  if (!LtoCompile(bcobjects, ltoobj))
+  {
+    return false;
+  }
+  objects.push_back(ltoobj);
+
+  bool result = LinkNative(objects, alibraries, aoutput);
+
+  error_code ec;
+  fs::remove(ltoobj, ec);
+  return result;
+}
+
+bool OLinkDriver::IsBitcodeFile(const string & afilename)
+{
+  ifstream f(afilename, ios::binary);
+  char magic[4] = {0};
+  if (!f.read(magic, sizeof(magic)))
+  {
+    return false;
+  }
+  return ('B' == magic[0]) and ('C' == magic[1]) and ('\xC0' == magic[2]) and ('\xDE' == magic[3]);
+}
+
+bool OLinkDriver::LinkNative(const vector<string> & aobjects, const vector<string> & alibraries, const string & aoutput)
+{
+  vector<string> args;
+
+  if (!use_gcc and !PrepareLinkEnv())
+  {
+    if (g_opt.verblevel >= VERBLEVEL_STATUS)
+    {
+      print("Link environment not found, falling back to the gcc driver.\n");
+    }
+    use_gcc = true;
+    linker = "gcc";
+  }
+
+  if (use_gcc)
+  {
+    args.push_back("gcc");
+    for (const string & obj : aobjects)
+    {
+      args.push_back(obj);
+    }
+    args.insert(args.end(), {"-o", aoutput, "-lm"});
+    for (const string & libname : alibraries)
+    {
+      args.push_back("-l" + libname);
+    }
+    return RunLinker(args);
+  }
+
+  // the same as the gcc driver does for a default PIE executable
+  args.insert(args.end(), {linker, "-pie", "--eh-frame-hdr", "--hash-style=gnu", "--build-id",
+                           "-dynamic-linker", dynamic_linker, "-o", aoutput,
+                           crt_dir + "/Scrt1.o", crt_dir + "/crti.o", gcc_lib_dir + "/crtbeginS.o",
+                           "-L" + gcc_lib_dir, "-L" + crt_dir});
+  for (const string & obj : aobjects)
+  {
+    args.push_back(obj);
+  }
+  args.push_back("-lm");
+  for (const string & libname : alibraries)
+  {
+    args.push_back("-l" + libname);
+  }
+  args.insert(args.end(), {"-lgcc", "--as-needed", "-lgcc_s", "--no-as-needed", "-lc",
+                           "-lgcc", "--as-needed", "-lgcc_s", "--no-as-needed",
+                           gcc_lib_dir + "/crtendS.o", crt_dir + "/crtn.o"});
+  return RunLinker(args);
+}
+
+bool OLinkDriver::LinkRelocatable(const vector<string> & aobjects, const string & aoutput)
+{
+  // the gcc driver is not needed for this, the linker is called directly in every mode
+  vector<string> args = {(use_gcc ? string("ld") : linker), "-r", "-o", aoutput};
+  for (const string & obj : aobjects)
+  {
+    args.push_back(obj);
+  }
+  return RunLinker(args);
+}
+
+bool OLinkDriver::RunLinker(const vector<string> & aargs)
+{
+  OProcessRunner runner;
+  runner.args = aargs;
+  bool ok = runner.Run();
+
+  if (g_opt.verblevel >= VERBLEVEL_INFO)
+  {
+    print("Link cmd: {}\n", runner.cmdline);
+  }
+
+  string errtext = runner.stderr_text;
+  if (!errtext.empty() and (errtext.back() != '\n'))
+  {
+    errtext += "\n";
+  }
+
+  if (!ok)
+  {
+    print("Failed to execute \"{}\": {}", aargs[0], errtext);
+    return false;
+  }
+
+  if (!runner.stdout_text.empty())
+  {
+    print("{}", runner.stdout_text);
+  }
+  if (!errtext.empty())
+  {
+    print("{}", errtext);
+  }
+
+  return (0 == runner.exit_code);
+}
+
+bool OLinkDriver::PrepareLinkEnv()
+{
+  string cachefn = CacheFileName();
+  if (!cachefn.empty() and LoadCache(cachefn) and LinkEnvValid())
+  {
+    return true;
+  }
+
+  if (!DiscoverLinkEnv())
+  {
+    return false;
+  }
+
+  if (g_opt.verblevel >= VERBLEVEL_INFO)
+  {
+    print("Link environment: crt=\"{}\", gcc=\"{}\", dynamic linker=\"{}\"\n", crt_dir, gcc_lib_dir, dynamic_linker);
+  }
+
+  if (!cachefn.empty())
+  {
+    SaveCache(cachefn);
+  }
+  return true;
+}
+
+bool OLinkDriver::LinkEnvValid()
+{
+  return FileExists(crt_dir + "/Scrt1.o") and FileExists(crt_dir + "/crti.o")
+         and FileExists(crt_dir + "/crtn.o") and FileExists(gcc_lib_dir + "/crtbeginS.o")
+         and FileExists(gcc_lib_dir + "/crtendS.o") and FileExists(dynamic_linker);
+}
+
+bool OLinkDriver::DiscoverLinkEnv()
+{
+  string multiarch = LINK_MULTIARCH;
+
+  crt_dir = FindDirWith({"/usr/lib/" + multiarch, "/usr/lib64", "/usr/lib", "/lib/" + multiarch, "/lib64"},
+                        {"Scrt1.o", "crti.o", "crtn.o"});
+  if (crt_dir.empty())
+  {
+    crt_dir = fs::path(GccPrintFileName("Scrt1.o")).parent_path().string();
+  }
+
+  // select the newest gcc version directory which has the crtbegin files
+  gcc_lib_dir = "";
+  int best_version = -1;
+  for (const string & gccroot : {string("/usr/lib/gcc"), string("/usr/lib64/gcc")})
+  {
+    error_code ec;
+    for (auto & tdir : fs::directory_iterator(gccroot, ec))
+    {
+      string tname = tdir.path().filename().string();
+      if (!multiarch.empty() and (tname.substr(0, tname.find('-')) != multiarch.substr(0, multiarch.find('-'))))
+      {
+        continue;  // other architecture
+      }
+      for (auto & vdir : fs::directory_iterator(tdir.path(), ec))
+      {
+        int version = atoi(vdir.path().filename().c_str());
+        if ((version > best_version) and FileExists(vdir.path().string() + "/crtbeginS.o"))
+        {
+          best_version = version;
+          gcc_lib_dir = vdir.path().string();
+        }
+      }
+    }
+  }
+  if (gcc_lib_dir.empty())
+  {
+    gcc_lib_dir = fs::path(GccPrintFileName("crtbeginS.o")).parent_path().string();
+  }
+
+  dynamic_linker = LINK_DYNAMIC_LINKER;
+
+  return LinkEnvValid();
+}
+
+string OLinkDriver::GccPrintFileName(const string & afilename)
+{
+  OProcessRunner runner;
+  runner.args = {"gcc", "-print-file-name=" + afilename};
+  if (!runner.Run() or (runner.exit_code != 0))
+  {
+    return "";
+  }
+
+  string result = runner.stdout_text;
+  while (!result.empty() and (('\n' == result.back()) or ('\r' == result.back())))
+  {
+    result.pop_back();
+  }
+  return result;
+}
+
+string OLinkDriver::CacheFileName()
+{
+  string cachedir = CompCacheBaseDir();
+  if (cachedir.empty())
+  {
+    return "";
+  }
+
+  return cachedir + "/linkenv-" + DQ_COMPILER_VERSION + ".txt";
+}
+
+bool OLinkDriver::LoadCache(const string & afilename)
+{
+  ifstream f(afilename);
+  if (!f)
+  {
+    return false;
+  }
+
+  string line;
+  while (getline(f, line))
+  {
+    size_t eqpos = line.find('=');
+    if (eqpos == string::npos)
+    {
+      continue;
+    }
+
+    string key = line.substr(0, eqpos);
+    string value = line.substr(eqpos + 1);
+    if      ("crt_dir"        == key)  crt_dir = value;
+    else if ("gcc_lib_dir"    == key)  gcc_lib_dir = value;
+    else if ("dynamic_linker" == key)  dynamic_linker = value;
+  }
+
+  return true;
+}
+
+void OLinkDriver::SaveCache(const string & afilename)
+{
+  error_code ec;
+  fs::create_directories(fs::path(afilename).parent_path(), ec);
+
+  // write to a temporary file first, so parallel compiler runs see either the old or the new file
+  string tmpfn = afilename + format(".tmp{}", getpid());
+  {
+    ofstream f(tmpfn);
+    if (!f)
+    {
+      return;
+    }
+    f << "crt_dir=" << crt_dir << "\n";
+    f << "gcc_lib_dir=" << gcc_lib_dir << "\n";
+    f << "dynamic_linker=" << dynamic_linker << "\n";
+  }
+  fs::rename(tmpfn, afilename, ec);
+}
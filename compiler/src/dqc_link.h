@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    dqc_link.h
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   link driver: calls the system linker directly (without shell and gcc)
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class OLinkDriver
+{
+public:
+  string           linker = "ld";    // ld, ld.lld, ld.gold, ... or full path, set by -fuse-ld=
+  bool             use_gcc = false;  // -fuse-ld=gcc: link with the gcc driver
+
+  // link environment, discovered once and then cached
+  string           crt_dir;          // Scrt1.o, crti.o, crtn.o, libc
+  string           gcc_lib_dir;      // crtbeginS.o, crtendS.o, libgcc
+  string           dynamic_linker;
+
+public:
+  OLinkDriver();
+  virtual ~OLinkDriver();
+
+  void SetLinker(const string & afuseld);  // -fuse-ld=<name|path>
+
+  bool Link(const vector<string> & aobjects, const vector<string> & alibraries, const string & aoutput);
+  bool LinkRelocatable(const vector<string> & aobjects, const string & aoutput);  // ld -r
+
+protected:
+  bool LinkNative(const vector<string> & aobjects, const vector<string> & alibraries, const string & aoutput);
+
+  bool IsBitcodeFile(const string & afilename);
+  bool LtoCompile(const vector<string> & abcobjects, const string & aoutput);  // dqc_link_lto.cpp
+
+  bool PrepareLinkEnv();
+  bool DiscoverLinkEnv();
+  bool LinkEnvValid();
+
+  string CacheFileName();
+  bool LoadCache(const string & afilename);
+  void SaveCache(const string & afilename);
+
+  string GccPrintFileName(const string & afilename);  // fallback for the discovery
+
+  bool RunLinker(const vector<string> & aargs);
+};
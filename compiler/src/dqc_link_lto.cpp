@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    dqc_link_lto.cpp
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   link time optimization: merges the bitcode objects and compiles them to one native object
+ */
+
+// these include also provide llvm::format() so the std::format() must be fully specified
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Target/TargetOptions.h>
+#include <llvm/MC/TargetRegistry.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Linker/Linker.h>
+#include <llvm/Transforms/IPO/Internalize.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Transforms/Scalar/InductiveRangeCheckElimination.h>
+#include <llvm/Transforms/Utils/LoopSimplify.h>
+
+#include <print>
+#include <format>
+
+#include "dqc_link.h"
+#include "comp_options.h"
+#include "comp_timing.h"
+#include "ll_defs.h"
+
+using namespace std;
+
+bool OLinkDriver::LtoCompile(const vector<string> & abcobjects, const string & aoutput)
+{
+  OTimeScope ts("Link time optimization");
+
+  if (g_opt.verblevel >= VERBLEVEL_STATUS)
+  {
+    print("Link time optimization of {} bitcode objects...\n", abcobjects.size());
+  }
+
+  // a separate context, the compilation contexts might belong to other (finished) threads
+  LlContext ctx;
+  auto merged = make_unique<LlModule>("dq-lto", ctx);
+  llvm::Linker lnk(*merged);
+  set<string> exported;
+  for (const string & fname : abcobjects)
+  {
+    auto buf = llvm::MemoryBuffer::getFile(fname);
+    if (!buf)
+    {
+      print("Error reading \"{}\": {}\n", fname, buf.getError().message());
+      return false;
+    }
+    auto mod_exp = llvm::parseBitcodeFile((*buf)->getMemBufferRef(), ctx);
+    if (!mod_exp)
+    {
+      print("Error reading bitcode \"{}\": {}\n", fname, llvm::toString(mod_exp.takeError()));
+      return false;
+    }
+    // the public definitions of the units might be referenced from the native objects and libraries too
+    for (const llvm::GlobalValue & gv : (*mod_exp)->global_values())
+    {
+      if (!gv.isDeclaration() and gv.hasExternalLinkage())
+      {
+        exported.insert(gv.getName().str());
+      }
+    }
+    if (lnk.linkInModule(std::move(*mod_exp)))
+    {
+      print("Error linking bitcode \"{}\"\n", fname);
+      return false;
+    }
+  }
+
+  // the exported definitions remain external (they are still inlined), the rest can be removed
+  llvm::internalizeModule(*merged,
+    [&exported](const llvm::GlobalValue & agv)
+    {
+      return exported.contains(agv.getName().str());
+    }
+  );
+
+  // the -march / -mcpu settings of the units are stored in the function attributes
+  string cpu;
+  string features;
+  for (LlFunction & f : *merged)
+  {
+    if (f.hasFnAttribute("target-cpu"))
+    {
+      cpu = f.getFnAttribute("target-cpu").getValueAsString().str();
+      if (f.hasFnAttribute("target-features"))
+      {
+        features = f.getFnAttribute("target-features").getValueAsString().str();
+      }
+      break;
+    }
+  }
+
+  string triple = merged->getTargetTriple();
+  string err;
+  auto * target = llvm::TargetRegistry::lookupTarget(triple, err);
+  if (!target)
+  {
+    print("LTO target error: {}\n", err);
+    return false;
+  }
+  unique_ptr<LlMachine> machine(target->createTargetMachine(triple, cpu, features, ll_target_options(), llvm::Reloc::PIC_));
+  if (!machine)
+  {
+    print("LTO error: unable to create target machine for CPU \"{}\"\n", cpu);
+    return false;
+  }
+
+  if (g_opt.optlevel > 0)
+  {
+    llvm::PassBuilder PB(machine.get());
+
+    llvm::LoopAnalysisManager     LAM;
+    llvm::FunctionAnalysisManager FAM;
+    llvm::CGSCCAnalysisManager    CGAM;
+    llvm::ModuleAnalysisManager   MAM;
+
+    PB.registerModuleAnalyses(MAM);
+    PB.registerCGSCCAnalyses(CGAM);
+    PB.registerFunctionAnalyses(FAM);
+    PB.registerLoopAnalyses(LAM);
+    PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
+
+    llvm::OptimizationLevel ll_optlevel = llvm::OptimizationLevel::O1;
+    if (2 == g_opt.optlevel)       ll_optlevel = llvm::OptimizationLevel::O2;
+    else if (3 == g_opt.optlevel)  ll_optlevel = llvm::OptimizationLevel::O3;
+
+    if (g_opt.bounds_check)
+    {
+      // the units got the IRCE in OptimizeIr() already, this covers the loops after the cross-unit inlining
+      // (the full LTO pipeline has no scalar optimizer late extension point, the peephole one runs after the inliner)
+      PB.registerPeepholeEPCallback(
+        [](llvm::FunctionPassManager & FPM, llvm::OptimizationLevel alevel)
+        {
+          FPM.addPass(llvm::LoopSimplifyPass());
+          FPM.addPass(llvm::IRCEPass());
+        }
+      );
+    }
+
+    llvm::ModulePassManager MPM = PB.buildLTODefaultPipeline(ll_optlevel, nullptr);
+    MPM.run(*merged, MAM);
+  }
+
+  error_code ec;
+  llvm::raw_fd_ostream out(aoutput, ec, llvm::sys::fs::OF_None);
+  if (ec)
+  {
+    print("Error writing \"{}\": {}\n", aoutput, ec.message());
+    return false;
+  }
+
+  llvm::legacy::PassManager pm;
+  if (machine->addPassesToEmitFile(pm, out, nullptr, llvm::CodeGenFileType::ObjectFile))
+  {
+    print("LTO error: the target can not emit object files\n");
+    return false;
+  }
+  pm.run(*merged);
+  out.flush();
+  return true;
+}
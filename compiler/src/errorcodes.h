@@ -101,6 +101,12 @@ DEF_DQ_ERR(DQERR_FLOAT_CONSTEXPR_ERROR,            "FloatConstExpr",         "Fl
 DEF_DQ_ERR(DQERR_CONSTEXPR_ERROR,                  "ConstExpr",              "$1 constant expressions error");
 DEF_DQ_ERR(DQERR_CONSTEXPR_INVALID_FOR,            "ConstExprInvalid",       "Invalid constant expression for \"$1\"");
 DEF_DQ_ERR(DQERR_CONSTEXPR_NONCONST_SYM,           "ConstExprNonConstVs",    "Non-constant symbol \"$1\" in $2 constant expression");
+DEF_DQ_ERR(DQERR_CONSTEVAL_CALL,                    "ConstEvalCall",          "Function \"$1\" is not [[consteval]], it cannot be called at compile time");
+DEF_DQ_ERR(DQERR_CONSTEVAL_NO_BODY,                 "ConstEvalNoBody",        "The body of the [[consteval]] function \"$1\" must be defined before its compile-time call");
+DEF_DQ_ERR(DQERR_CONSTEVAL_UNSUPPORTED,             "ConstEvalUnsupported",   "$1 is not supported in the compile-time evaluation of \"$2\"");
+DEF_DQ_ERR(DQERR_CONSTEVAL_LIMIT,                   "ConstEvalLimit",         "Compile-time evaluation of \"$1\" exceeded the $2");
+DEF_DQ_ERR(DQERR_CONSTEVAL_DIV_ZERO,                "ConstEvalDivZero",       "Division by zero in the compile-time evaluation of \"$1\"");
+DEF_DQ_ERR(DQERR_CONSTEVAL_INDEX,                   "ConstEvalIndex",         "Array index $1 is out of range 0..$2 in the compile-time evaluation of \"$3\"");
 
 DEF_DQ_ERR(DQERR_MODULE_STATEMENT_EXPECTED,        "ModStatementExpected",   "Module statement keyword expected");
 DEF_DQ_ERR(DQERR_MODULE_STATEMENT_UNKNOWN,         "ModStatementUnknown",    "Unknown module statement \"$1\"");
@@ -112,6 +118,15 @@ DEF_DQ_ERR(DQERR_ATTR_PAREN_NOT_ALLOWED,           "AttrNoArgs",             "At
 DEF_DQ_ERR(DQERR_ATTR_ARG_INT,                     "AttrArgInt",             "Attribute \"$1\" expects an integer literal argument");
 DEF_DQ_ERR(DQERR_ATTR_ARG_POSITIVE_INT,            "AttrArgPosInt",          "Attribute \"$1\" expects a positive integer argument");
 DEF_DQ_ERR(DQERR_ATTR_ARG_STRING,                  "AttrArgString",          "Attribute \"$1\" expects a string literal argument");
+DEF_DQ_ERR(DQERR_ATTR_CONFLICT,                    "AttrConflict",           "Attributes \"$1\" and \"$2\" can not be used together");
+DEF_DQ_ERR(DQERR_ATTR_ARG_ID,                      "AttrArgId",              "Attribute \"$1\" expects one of: $2");
+DEF_DQ_ERR(DQERR_ATTR_PURE_WRITE_PARAM,            "AttrPureWriteParam",     "Attribute \"$1\" does not allow the writable reference parameter \"$2\"");
+DEF_DQ_ERR(DQERR_ATTR_PURE_WRITE,                  "AttrPureWrite",          "Attribute \"$1\" does not allow writing $2");
+DEF_DQ_ERR(DQERR_ATTR_PURE_CALL,                   "AttrPureCall",           "Attribute \"$1\" does not allow calling \"$2\", which is not $3");
+DEF_DQ_ERR(DQERR_ATTR_READNONE_READ,               "AttrReadnoneRead",       "Attribute \"readnone\" does not allow reading the global variable \"$1\"");
+DEF_DQ_ERR(DQERR_ATTR_READNONE_DEREF,              "AttrReadnoneDeref",      "Attribute \"readnone\" does not allow reading the memory through $1");
+DEF_DQ_ERR(DQERR_ATTR_READNONE_REF_PARAM,          "AttrReadnoneRefParam",   "Attribute \"readnone\" does not allow the reference parameter \"$1\"");
+DEF_DQ_ERR(DQERR_ATTR_READNONE_METHOD,             "AttrReadnoneMethod",     "Attribute \"readnone\" is not allowed on the object methods, they read the object fields");
 
 DEF_DQ_ERR(DQERR_TYPE_SPECIFIER_EXPECTED,          "TypeSpecExpected",       "Type specifier \":\" is expected");
 DEF_DQ_ERR(DQERR_TYPE_SPECIFIER_EXP_AFTER,         "TypeSpecExpected",       "Type specifier \":\" is expected after \"$1\"");
@@ -163,6 +178,7 @@ DEF_DQ_ERR(DQERR_REF_LOCAL_TYPE_INFER,             "RefLocalTypeInfer",      "Lo
 DEF_DQ_ERR(DQERR_REF_LOCAL_TYPE_MISM,              "RefLocalType",           "Local ref \"$1\" type mismatch: \"$2\" = \"$3\"");
 DEF_DQ_ERR(DQERR_REF_LOCAL_MODE_UNSUPPORTED,       "RefLocalMode",           "Local \"$1\" declarations are not supported");
 DEF_DQ_ERR(DQERR_REF_ASSIGN_READONLY,              "RefReadonly",            "Assignment target \"$1\" is read-only");
+DEF_DQ_ERR(DQERR_ADDR_OF_READONLY,                 "AddrOfReadonly",         "The address of the read-only \"$1\" can not be taken");
 DEF_DQ_ERR(DQERR_REFOUT_READ_BEFORE_WRITE,         "RefOutRead",             "Output-only reference \"$1\" is read before assignment");
 
 DEF_DQ_ERR(DQERR_ARR_ELEMCOUNT_MISM,               "ArrElemCount",           "Array element count mismatch: expected $1, got $2");  // for array literal definitions
@@ -174,6 +190,11 @@ DEF_DQ_ERR(DQERR_CSTR_SIZE_INVALID,                "CStrSizeInvalid",        "In
 DEF_DQ_ERR(DQERR_CSTR_CONSTEXPR,                   "CStrConstExpr",          "CString constant expression error: string literal expected");
 DEF_DQ_ERR(DQERR_CSTR_CONVERSION,                  "CStrConversion",         "Invalid CString conversion");  // used with custom text
 
+DEF_DQ_ERR(DQERR_VEC_TYPE_EXPECTED,                "VecTypeExpected",        "SIMD vector type expected for \"$1\", got \"$2\"");
+DEF_DQ_ERR(DQERR_VEC_LANES_MISM,                   "VecLanes",               "Vector lane count mismatch: \"$1\" and \"$2\"");
+DEF_DQ_ERR(DQERR_VEC_SHUFFLE_INDEX,                "VecShuffleIndex",        "Invalid vshuffle() lane index $1, it must be a constant in the range 0..$2");
+DEF_DQ_ERR(DQERR_VEC_ELEM_REF,                     "VecElemRef",             "Array element reference expected for \"$1\", example: arr[i]");
+
 DEF_DQ_ERR(DQERR_PTRARITH_TYPE,                    "PtrArithType",           "Pointer arithmetic requires an integer offset, got \"$1\"");
 
 DEF_DQ_ERR(DQERR_VARARGS_NOT_ALLOWED,              "VarargsNotAllowed",      "Variadic \"...\" is only allowed on [[external]] functions");
@@ -203,6 +224,9 @@ DEF_DQ_ERR(DQERR_EXPR_NOT_CALLABLE,                "ExprNotCallable",        "Ex
 DEF_DQ_ERR(DQERR_CONDEXPR_MISSING_FOR,             "CondExprMissing",        "Condition expression is mission for \"$1\"");
 DEF_DQ_ERR(DQERR_BOOL_EXPR_EXPECTED,               "BoolExprExpected",       "bool expression expected, got \"$1\"");
 DEF_DQ_ERR(DQERR_MULTIPLE_ELSE,                    "MultipleElse",           "Multiple else branches detected");
+DEF_DQ_ERR(DQERR_FOR_IN_EXPECTED,                  "ForInExpected",          "\"in\" is expected after the for loop variable \"$1\"");
+DEF_DQ_ERR(DQERR_FOR_RANGE_EXPECTED,               "ForRangeExpected",       "for loop range \"<start>..<end>\" is expected");
+DEF_DQ_ERR(DQERR_FOR_RANGE_TYPE,                   "ForRangeType",           "for loop range bounds must be integers, got \"$1\"");
 
 DEF_DQ_ERR(DQERR_EXPR_INVALID_ADDROF,              "ExprAddrofInvalid",      "Invalid expression for the address of \"&\" operator");
 DEF_DQ_ERR(DQERR_EXPR_VS_NOT_ADDRESSABLE,          "ExprVsNotAddressable",   "\"$1\" is not a variable, cannot take its address");
@@ -231,6 +255,7 @@ DEF_DQ_ERR(DQERR_CDIR_EXPR_TYPE,                   "CDirExprType",           "Co
 //-----------------------------------------------------------------------------
 
 DEF_DQ_WARN(DQWARN_ATTR_IGNORED_FOR,               "AttrIgnored",            "Attribute \"$1\" is not applicable to $2 and will be ignored");
+DEF_DQ_WARN(DQWARN_LOOP_HINT_NOT_HONORED,          "LoopHint",               "Loop optimization hint was not honored: $1");
 
 //-----------------------------------------------------------------------------
 // HINTS
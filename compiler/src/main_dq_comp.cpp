@@ -28,6 +28,8 @@
 #include <fstream>
 #include <sstream>
 
+#include <llvm/Support/raw_ostream.h>
+
 #include "dqc.h"
 #include "version.h"
 
@@ -154,6 +156,18 @@ int main(int argc, char ** argv)
   g_compiler->Run(argc, argv);
   r = g_compiler->errorcnt;
 
+  if ((0 == r) and !g_opt.full_teardown)
+  {
+    // The outputs are complete, destroying the module, the symbols and the LLVM context
+    // would only give back the memory to the OS. The thread local and static destructors
+    // are skipped too, so the stdio and the LLVM streams (-ir output) must be flushed here.
+    cout.flush();
+    fflush(nullptr);
+    llvm::outs().flush();
+    llvm::errs().flush();
+    _exit(0);
+  }
+
   delete g_compiler;
 
   //printf("\n");
@@ -11,10 +11,68 @@
  * brief:   DQ Compiler Version Description
  */
 
-#define DQ_COMPILER_VERSION  "0.9.1"
+#define DQ_COMPILER_VERSION  "0.9.26"
 
 /* CHANGE LOG
 ------------------------------------------------------------------------------------
+v0.9.26:
+  - Fast exit after a successful compilation without the compiler state teardown, --full-teardown keeps
+    the destructor path
+v0.9.25:
+  - Arena allocation (dqc_arena.h) for the AST, symbol and scope objects, -fstats prints the allocation
+    counts and the peak memory
+v0.9.24:
+  - Identifier interning (dqc_idents.h), the scope symbol tables are id keyed open addressing hash tables
+v0.9.23:
+  - Keyword table with a compile-time perfect hash (dqc_keywords.h), the parser keyword and builtin
+    function dispatch switches on the EKeyword
+v0.9.22:
+  - Source tokenizer: token array per source file with interned identifiers, the SkipWhite() jumps over the
+    whitespace and comments by the token array, -ftime-report shows the token count
+v0.9.21:
+  - Function attributes: [[inline]], [[noinline]], [[flatten]], [[hot]], [[cold]], [[pure]], [[readnone]],
+    the [[inline]] and [[flatten]] inlining is done also at -O0
+v0.9.20:
+  - Index bounds checking: -fbounds-check and [[bounds_check(on|off)]] function attribute for the arrays,
+    slices and cstrings, the failed checks report file:line and trap, constant ranges are not checked
+v0.9.19:
+  - Compile-time function evaluation: [[consteval]] functions are interpreted in constant expressions,
+    constant arrays got read-only storage for the runtime indexing
+v0.9.18:
+  - SIMD vector types (float32x8, int32x4, ...) with lane-wise operators, comparison masks (boolxN),
+    vload(), vstore(), vshuffle(), vselect() and horizontal reductions
+v0.9.17:
+  - Loop hint attributes: [[unroll]], [[no_unroll]], [[vectorize]], [[no_vectorize]], [[interleave]] as llvm.loop metadata
+v0.9.16:
+  - Counted for loop: "for i in <start>..<end>: ... endfor" with canonical LLVM loop structure
+v0.9.15:
+  - C ABI compatible aggregate calling convention: byval / sret above 16 bytes, register coercion below
+v0.9.14:
+  - Integer overflow model: -fint-overflow=wrap|nsw|trap and [[overflow(...)]] function attribute
+v0.9.13:
+  - Floating point model: -ffast-math, -ffp-contract=off|on|fast, [[fastmath]] function attribute
+v0.9.12:
+  - All local variables are allocated in the function entry block
+v0.9.11:
+  - Line start index for the source files, fixed column calculation at the file start
+v0.9.10:
+  - Memory mapped source files (-fno-mmap for the copying mode), source load and peak RSS statistics
+v0.9.9:
+  - Persistent object cache (-fcache, -fcache-dir=<dir>, -fcache-size=<n>)
+v0.9.8:
+  - Link time optimization (-flto): bitcode objects, whole program optimization at linking
+v0.9.7:
+  - Multi-threaded code generation with module partitions (-fcodegen-threads=<n>)
+v0.9.6:
+  - Parallel compilation of multiple input files (-j <n>), thread local compilation state
+v0.9.5:
+  - Link driver calling the linker directly (no shell and gcc), -fuse-ld=<linker>
+v0.9.4:
+  - Compilation time report (-ftime-report) and Chrome trace output (-ftime-trace)
+v0.9.3:
+  - dq-run --jit: in-process execution with the LLVM ORC JIT
+v0.9.2:
+  - Target CPU selection: -march=native, -mcpu=<name>, -mattr=<features>
 v0.9.1:
   - Object methods share the capabilities like normal root functions
 v0.9.0:
@@ -18,6 +18,7 @@
 #include <unistd.h>
 
 #include "processrunner.h"
+#include "dqc.h"
 
 using namespace std;
 namespace fs = std::filesystem;
@@ -29,6 +30,7 @@ struct SDqRunOptions
   string          input_filename;
   string          output_filename;
   bool            has_dash_o = false;
+  bool            jit = false;
 };
 
 static void PrintUsage()
@@ -36,6 +38,8 @@ static void PrintUsage()
   print("Usage:\n");
   print("  dq-run [compiler-options] <file.dq> [program-args...]\n");
   print("  dq-run [compiler-options] <file.dq> -- [program-args...]\n");
+  print("Options:\n");
+  print("  --jit     : compile and run main() in-process (no object file, no linking)\n");
   print("Notes:\n");
   print("  - compiler options must come before <file.dq>\n");
   print("  - program output is shown live\n");
@@ -77,6 +81,12 @@ static bool ParseArgs(int argc, char ** argv, SDqRunOptions & opt)
           return false;
         }
 
+        if ("--jit" == arg)
+        {
+          opt.jit = true;
+          continue;
+        }
+
         opt.compiler_args.push_back(arg);
 
         if (NeedsCompilerValue(arg))
@@ -170,6 +180,34 @@ static string ResolveRunExecutable(const string & output_filename)
   return output_filename;
 }
 
+static int RunJit(const SDqRunOptions & opt)
+{
+  dqc_init(); // creates the compiler object
+
+  g_opt.jit_run = true;
+  g_compiler->jit_args.push_back(opt.output_filename);
+  for (const string & arg : opt.run_args)
+  {
+    g_compiler->jit_args.push_back(arg);
+  }
+
+  vector<char *> comp_argv;
+  comp_argv.push_back((char *)"dq-run");
+  for (const string & arg : opt.compiler_args)
+  {
+    comp_argv.push_back((char *)arg.c_str());
+  }
+  comp_argv.push_back(nullptr);
+
+  g_compiler->Run(int(comp_argv.size() - 1), comp_argv.data());
+  if (g_compiler->errorcnt)
+  {
+    return 1;
+  }
+
+  return g_compiler->jit_exit_code;
+}
+
 int main(int argc, char ** argv)
 {
   SDqRunOptions opt;
@@ -179,6 +217,11 @@ int main(int argc, char ** argv)
     return 1;
   }
 
+  if (opt.jit)
+  {
+    return RunJit(opt);
+  }
+
   OProcessRunner compiler_runner;
   compiler_runner.args.reserve(opt.compiler_args.size() + 1);
   compiler_runner.args.push_back(ResolveCompilerExecutable());
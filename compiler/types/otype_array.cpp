@@ -55,7 +55,7 @@ LlConst * OValueArray::CreateLlConst()
   return llvm::ConstantArray::get(ll_arrtype, ll_elems);
 }
 
-bool OValueArray::CalculateConstant(OExpr * expr, bool emit_errors)
+bool OValueArray::CalculateConstantExpr(OExpr * expr, bool emit_errors)
 {
   auto * arrtype = static_cast<OTypeArray *>(ptype);
 
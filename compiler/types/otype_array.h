@@ -27,7 +27,7 @@ public:
   ~OValueArray() override;
 
   LlConst *  CreateLlConst() override;
-  bool       CalculateConstant(OExpr * expr, bool emit_errors = true) override;
+  bool       CalculateConstantExpr(OExpr * expr, bool emit_errors) override;
 };
 
 // Fixed-size array type, e.g. int[3]
@@ -20,7 +20,7 @@ LlConst * OValueBool::CreateLlConst()
   return llvm::ConstantInt::get(ptype->GetLlType(), (value ? 1 : 0));
 }
 
-bool OValueBool::CalculateConstant(OExpr * expr, bool emit_errors)
+bool OValueBool::CalculateConstantExpr(OExpr * expr, bool emit_errors)
 {
   value = 0;
 
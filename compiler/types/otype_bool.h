@@ -31,7 +31,7 @@ public:
   }
 
   LlConst *  CreateLlConst() override;
-  bool       CalculateConstant(OExpr * expr, bool emit_errors = true) override;
+  bool       CalculateConstantExpr(OExpr * expr, bool emit_errors) override;
 };
 
 class OTypeBool : public OType
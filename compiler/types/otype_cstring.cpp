@@ -114,7 +114,7 @@ LlConst * OValueCString::CreateLlConst()
   return llvm::ConstantArray::get(arrtype, chars);
 }
 
-bool OValueCString::CalculateConstant(OExpr * expr, bool emit_errors)
+bool OValueCString::CalculateConstantExpr(OExpr * expr, bool emit_errors)
 {
   auto * strlit = dynamic_cast<OCStringLit *>(expr);
   if (strlit)
@@ -20,7 +20,7 @@ LlConst * OValueFloat::CreateLlConst()
   return llvm::ConstantFP::get(ptype->GetLlType(), value);
 }
 
-bool OValueFloat::CalculateConstant(OExpr * expr, bool emit_errors)
+bool OValueFloat::CalculateConstantExpr(OExpr * expr, bool emit_errors)
 {
   value = 0;
 
@@ -12,12 +12,15 @@
  */
 
 #include <algorithm>
+#include <llvm/TargetParser/Triple.h>
 
 #include "otype_func.h"
+#include "otype_int.h"
 #include "dqc.h"
 #include "dq_module.h"
 #include "errorcodes.h"
 #include "ll_defs.h"
+#include "comp_timing.h"
 
 void OValSymFunc::ApplyAttributes(OAttr * attr, EAttrTarget atarget)
 {
@@ -33,6 +36,39 @@ void OValSymFunc::ApplyAttributes(OAttr * attr, EAttrTarget atarget)
     is_external = true;
     external_linkage_name = attr->external_linkage_name;
   }
+
+  if (ATGT_FUNCTION == atarget)
+  {
+    attr_fastmath = attr->IsSet(ATTF_FASTMATH);
+    attr_overflow = (attr->IsSet(ATTF_OVERFLOW) ? attr->overflow_mode : -1);
+    attr_bounds_check = (attr->IsSet(ATTF_BOUNDS_CHECK) ? int(0 == attr->bounds_check_mode) : -1);
+    attr_consteval = attr->IsSet(ATTF_CONSTEVAL);
+    attr_fnhints = (attr->flags & (ATTF_INLINE | ATTF_NOINLINE | ATTF_FLATTEN | ATTF_HOT | ATTF_COLD
+                                   | ATTF_PURE | ATTF_READNONE));
+
+    // the pure functions can not write to their reference parameters, the receiver of the pure methods
+    // is read-only, the assignments to the fields are rejected by the parser
+    if (attr_fnhints & (ATTF_PURE | ATTF_READNONE))
+    {
+      EAttrFlag pureflag = (attr->IsSet(ATTF_PURE) ? ATTF_PURE : ATTF_READNONE);
+      if ((ATTF_READNONE == pureflag) and owner_compound_type)
+      {
+        g_compiler->Error(DQERR_ATTR_READNONE_METHOD, &attr->scpos);
+      }
+      for (OFuncParam * fpar : static_cast<OTypeFunc *>(ptype)->params)
+      {
+        if (((FPM_REF == fpar->mode) or (FPM_REFOUT == fpar->mode)) and ("__this" != fpar->name))
+        {
+          g_compiler->Error(DQERR_ATTR_PURE_WRITE_PARAM, AttrName(pureflag), fpar->name, &attr->scpos);
+        }
+        else if ((ATTF_READNONE == pureflag) and fpar->IsRefLike() and ("__this" != fpar->name))
+        {
+          // the read-only references are loaded from the caller's memory, memory(none) does not allow that
+          g_compiler->Error(DQERR_ATTR_READNONE_REF_PARAM, fpar->name, &attr->scpos);
+        }
+      }
+    }
+  }
 }
 
 OFuncParam * OTypeFunc::AddParam(const string aname, OType * atype, EParamMode amode)
@@ -449,25 +485,546 @@ void ValidateModuleForwardFuncDecls(OModule * module)
   }
 }
 
-LlType * OTypeFunc::CreateLlType()  // do not call GetLlType() until the function arguments fully prepared
+// eightbyte classes of the System V x86-64 ABI
+enum EAbiClass
 {
-  vector<LlType *> ll_partypes;
-  for (OFuncParam * fpar : params)
+  ABIC_NONE = 0,
+  ABIC_SSE,
+  ABIC_SSEUP,   // the upper half of a 16 byte vector, passed in the same XMM register
+  ABIC_INTEGER
+};
+
+static void AbiClassifyLeaves(LlType * atype, uint64_t aoffset, EAbiClass * rclasses, bool * rhas_float32)
+{
+  const llvm::DataLayout & dl = ll_module->getDataLayout();
+  if (auto * sttype = dyn_cast<llvm::StructType>(atype))
+  {
+    const llvm::StructLayout * sl = dl.getStructLayout(sttype);
+    for (unsigned i = 0; i < sttype->getNumElements(); ++i)
+    {
+      AbiClassifyLeaves(sttype->getElementType(i), aoffset + sl->getElementOffset(i), rclasses, rhas_float32);
+    }
+  }
+  else if (auto * arrtype = dyn_cast<llvm::ArrayType>(atype))
+  {
+    uint64_t elemsize = dl.getTypeAllocSize(arrtype->getElementType());
+    for (uint64_t i = 0; i < arrtype->getNumElements(); ++i)
+    {
+      AbiClassifyLeaves(arrtype->getElementType(), aoffset + i * elemsize, rclasses, rhas_float32);
+    }
+  }
+  else
+  {
+    unsigned eb = unsigned(aoffset / 8);
+    if (atype->isVectorTy() and (dl.getTypeAllocSize(atype) > 8))
+    {
+      // a vector covers all of its eightbytes: SSE, then SSEUP (the aggregate is at most 16 bytes here)
+      if (ABIC_NONE == rclasses[eb])  rclasses[eb] = ABIC_SSE;
+      if (ABIC_NONE == rclasses[eb + 1])  rclasses[eb + 1] = ABIC_SSEUP;
+    }
+    else if (atype->isFloatingPointTy() or atype->isVectorTy())
+    {
+      if (ABIC_NONE == rclasses[eb])  rclasses[eb] = ABIC_SSE;
+      if (atype->isFloatTy())         rhas_float32[eb] = true;
+    }
+    else
+    {
+      rclasses[eb] = ABIC_INTEGER;  // the integer class wins
+    }
+  }
+}
+
+// the scalar and vector leaves of an aggregate with their offsets, for the AArch64 and RISC-V rules
+struct TAbiLeaf
+{
+  LlType *   ll_type;
+  uint64_t   offset;
+};
+
+static void AbiCollectLeaves(LlType * atype, uint64_t aoffset, vector<TAbiLeaf> & rleaves)
+{
+  const llvm::DataLayout & dl = ll_module->getDataLayout();
+  if (auto * sttype = dyn_cast<llvm::StructType>(atype))
+  {
+    const llvm::StructLayout * sl = dl.getStructLayout(sttype);
+    for (unsigned i = 0; i < sttype->getNumElements(); ++i)
+    {
+      AbiCollectLeaves(sttype->getElementType(i), aoffset + sl->getElementOffset(i), rleaves);
+    }
+  }
+  else if (auto * arrtype = dyn_cast<llvm::ArrayType>(atype))
+  {
+    uint64_t elemsize = dl.getTypeAllocSize(arrtype->getElementType());
+    for (uint64_t i = 0; i < arrtype->getNumElements(); ++i)
+    {
+      AbiCollectLeaves(arrtype->getElementType(), aoffset + i * elemsize, rleaves);
+    }
+  }
+  else
+  {
+    rleaves.push_back({atype, aoffset});
+  }
+}
+
+// the integer registers: one or two 64-bit registers, a 16 byte aligned aggregate takes an aligned pair
+static LlType * AbiIntRegsType(uint64_t asize, uint64_t aalign)
+{
+  if (asize <= 8)    return LlType::getInt64Ty(ll_ctx);
+  if (aalign >= 16)  return LlType::getInt128Ty(ll_ctx);
+  return llvm::ArrayType::get(LlType::getInt64Ty(ll_ctx), 2);
+}
+
+// AAPCS64, the same rules for the parameters and the results
+static TAbiArgInfo AbiClassifyAArch64(LlType * ll_type, uint64_t size, uint64_t align)
+{
+  const llvm::DataLayout & dl = ll_module->getDataLayout();
+  TAbiArgInfo result;
+
+  vector<TAbiLeaf> leaves;
+  AbiCollectLeaves(ll_type, 0, leaves);
+
+  // homogeneous floating point / short vector aggregate (HFA, HVA): one SIMD register per member
+  LlType * basetype = leaves[0].ll_type;
+  uint64_t basesize = dl.getTypeAllocSize(basetype);
+  bool     homogeneous = ((leaves.size() <= 4) and (leaves.size() * basesize == size)
+                          and (basetype->isFloatingPointTy() or (basetype->isVectorTy() and ((8 == basesize) or (16 == basesize)))));
+  for (TAbiLeaf & leaf : leaves)
+  {
+    homogeneous = (homogeneous and (leaf.ll_type == basetype));
+  }
+
+  if (homogeneous)
+  {
+    result.pass = ABIP_COERCE;
+    result.ll_abitype = llvm::ArrayType::get(basetype, leaves.size());
+  }
+  else if (size > 16)
+  {
+    result.pass = ABIP_INDIRECT;  // reference to a caller made copy, the sret pointer goes in x8
+  }
+  else
+  {
+    result.pass = ABIP_COERCE;
+    result.ll_abitype = AbiIntRegsType(size, align);
+  }
+  return result;
+}
+
+// RISC-V LP64D, the same rules for the parameters and the results
+// (the integer convention fallback for the exhausted floating point registers is not tracked)
+static TAbiArgInfo AbiClassifyRiscV64(LlType * ll_type, uint64_t size, uint64_t align)
+{
+  const llvm::DataLayout & dl = ll_module->getDataLayout();
+  TAbiArgInfo result;
+
+  if (size > 16)  // above 2 x XLEN
+  {
+    result.pass = ABIP_INDIRECT;  // reference to a caller made copy, results through sret
+    return result;
+  }
+
+  vector<TAbiLeaf> leaves;
+  AbiCollectLeaves(ll_type, 0, leaves);
+
+  // hardware floating point convention: one or two members, at least one of them floating point
+  bool fpregs = (leaves.size() <= 2);
+  bool has_fp = false;
+  for (TAbiLeaf & leaf : leaves)
+  {
+    has_fp = (has_fp or leaf.ll_type->isFloatingPointTy());
+    fpregs = (fpregs and (leaf.ll_type->isFloatingPointTy() or leaf.ll_type->isIntegerTy())
+              and (dl.getTypeAllocSize(leaf.ll_type) <= 8));
+  }
+  if (fpregs and has_fp)
+  {
+    if (1 == leaves.size())
+    {
+      result.pass = ABIP_COERCE;
+      result.ll_abitype = leaves[0].ll_type;
+      return result;
+    }
+
+    auto * ll_pair = llvm::StructType::get(ll_ctx, {leaves[0].ll_type, leaves[1].ll_type});
+    if (dl.getStructLayout(ll_pair)->getElementOffset(1) == leaves[1].offset)
+    {
+      result.pass = ABIP_COERCE;
+      result.ll_abitype = ll_pair;
+      return result;
+    }
+  }
+
+  result.pass = ABIP_COERCE;
+  result.ll_abitype = AbiIntRegsType(size, align);
+  return result;
+}
+
+TAbiArgInfo AbiClassify(OType * atype)
+{
+  TAbiArgInfo result;
+  OType * rtype = atype->ResolveAlias();
+  if ((TK_ARRAY != rtype->kind) and (TK_COMPOUND != rtype->kind))
+  {
+    return result;  // scalars, pointers and the {ptr, len} descriptors are passed directly
+  }
+
+  LlType * ll_type = rtype->GetLlType();
+  uint64_t size = ll_module->getDataLayout().getTypeAllocSize(ll_type);
+  if (0 == size)
+  {
+    return result;
+  }
+
+#if defined(TARGET_32BIT)
+  result.pass = ABIP_INDIRECT;  // i386: aggregates on the stack, results through sret
+  result.byval = true;
+#elif defined(TARGET_WIN)
+  if ((1 == size) or (2 == size) or (4 == size) or (8 == size))
+  {
+    result.pass = ABIP_COERCE;
+    result.ll_abitype = LlType::getIntNTy(ll_ctx, unsigned(size * 8));
+  }
+  else
+  {
+    result.pass = ABIP_INDIRECT;
+  }
+#else
+  uint64_t align = ll_module->getDataLayout().getABITypeAlign(ll_type).value();
+  llvm::Triple::ArchType arch = llvm::Triple(ll_module->getTargetTriple()).getArch();
+  if (llvm::Triple::aarch64 == arch)
+  {
+    return AbiClassifyAArch64(ll_type, size, align);
+  }
+  if (llvm::Triple::riscv64 == arch)
+  {
+    return AbiClassifyRiscV64(ll_type, size, align);
+  }
+  if (llvm::Triple::x86_64 != arch)
+  {
+    return result;  // not classified, the aggregates remain first class values
+  }
+
+  // System V x86-64, the same rules for the parameters and the results
+  if (size > 16)
+  {
+    result.pass = ABIP_INDIRECT;
+    result.byval = true;
+    return result;
+  }
+
+  EAbiClass  classes[2] = {ABIC_NONE, ABIC_NONE};
+  bool       has_float32[2] = {false, false};
+  AbiClassifyLeaves(ll_type, 0, classes, has_float32);
+
+  vector<LlType *> ebtypes;
+  if ((ABIC_SSE == classes[0]) and (ABIC_SSEUP == classes[1]))
   {
-    ll_partypes.push_back(fpar->GetLlArgType()->GetLlType());
+    // a single 16 byte vector: one XMM register, like the __m128 members in C
+    ebtypes.push_back(llvm::FixedVectorType::get(LlType::getDoubleTy(ll_ctx), 2));
   }
+  else
+  {
+    for (unsigned eb = 0; eb * 8 < size; ++eb)
+    {
+      uint64_t ebsize = min<uint64_t>(8, size - eb * 8);
+      if (ABIC_SSE == classes[eb])
+      {
+        if (ebsize <= 4)           ebtypes.push_back(LlType::getFloatTy(ll_ctx));
+        else if (has_float32[eb])  ebtypes.push_back(llvm::FixedVectorType::get(LlType::getFloatTy(ll_ctx), 2));
+        else                       ebtypes.push_back(LlType::getDoubleTy(ll_ctx));
+      }
+      else
+      {
+        ebtypes.push_back(LlType::getIntNTy(ll_ctx, unsigned(ebsize * 8)));
+      }
+    }
+  }
+
+  result.pass = ABIP_COERCE;
+  if (1 == ebtypes.size())
+  {
+    result.ll_abitype = ebtypes[0];
+  }
+  else
+  {
+    result.ll_abitype = llvm::StructType::get(ll_ctx, ebtypes);
+  }
+#endif
+
+  return result;
+}
+
+#if !defined(TARGET_32BIT) && !defined(TARGET_WIN)
+// System V x86-64: the number of argument registers taken by a parameter, the first class
+// aggregates are split into their elements
+static void AbiCountRegs(LlType * atype, int & rgpr, int & rsse)
+{
+  if (auto * sttype = dyn_cast<llvm::StructType>(atype))
+  {
+    for (unsigned i = 0; i < sttype->getNumElements(); ++i)
+    {
+      AbiCountRegs(sttype->getElementType(i), rgpr, rsse);
+    }
+  }
+  else if (auto * arrtype = dyn_cast<llvm::ArrayType>(atype))
+  {
+    for (uint64_t i = 0; i < arrtype->getNumElements(); ++i)
+    {
+      AbiCountRegs(arrtype->getElementType(), rgpr, rsse);
+    }
+  }
+  else if (atype->isFloatingPointTy() or atype->isVectorTy())
+  {
+    rsse += 1;
+  }
+  else if (atype->isIntegerTy() and (atype->getIntegerBitWidth() > 64))
+  {
+    rgpr += 2;
+  }
+  else
+  {
+    rgpr += 1;
+  }
+}
+#endif
+
+// temporary storage for the coerced values, large and aligned enough for both representations
+static llvm::AllocaInst * AbiCreateCoerceTemp(OType * atype, const TAbiArgInfo & aabi, const string & aname)
+{
+  const llvm::DataLayout & dl = ll_module->getDataLayout();
+  auto * result = static_cast<llvm::AllocaInst *>(ll_create_alloca(aabi.ll_abitype, aname));
+  result->setAlignment(max(dl.getPrefTypeAlign(aabi.ll_abitype), dl.getPrefTypeAlign(atype->GetLlType())));
+  return result;
+}
+
+// the coerced type might be larger than the aggregate, so the conversion goes through memory
+static void AbiStoreCoerced(LlValue * ll_value, LlValue * ll_dst, OType * atype, const TAbiArgInfo & aabi)
+{
+  const llvm::DataLayout & dl = ll_module->getDataLayout();
+  llvm::AllocaInst * ll_tmp = AbiCreateCoerceTemp(atype, aabi, "coerce.tmp");
+  ll_builder.CreateStore(ll_value, ll_tmp);
+  ll_builder.CreateMemCpy(ll_dst, dl.getABITypeAlign(atype->GetLlType()), ll_tmp, ll_tmp->getAlign(),
+                          dl.getTypeAllocSize(atype->GetLlType()));
+}
+
+static LlValue * AbiLoadCoerced(LlValue * ll_src, OType * atype, const TAbiArgInfo & aabi)
+{
+  const llvm::DataLayout & dl = ll_module->getDataLayout();
+  llvm::AllocaInst * ll_tmp = AbiCreateCoerceTemp(atype, aabi, "coerce.tmp");
+  ll_builder.CreateMemCpy(ll_tmp, ll_tmp->getAlign(), ll_src, dl.getABITypeAlign(atype->GetLlType()),
+                          dl.getTypeAllocSize(atype->GetLlType()));
+  return ll_builder.CreateLoad(aabi.ll_abitype, ll_tmp, "coerce.val");
+}
+
+LlType * OTypeFunc::CreateLlType()  // do not call GetLlType() until the function arguments fully prepared
+{
+  LlType * ll_ptrtype = llvm::PointerType::get(ll_ctx, 0);
+
+  vector<LlType *> ll_partypes;
   LlType *  ll_rettype;
+  abi_result = TAbiArgInfo();
   if (rettype)
   {
-    ll_rettype = ResolvedRetType()->GetLlType();
+    abi_result = AbiClassify(ResolvedRetType());
+    if (ABIP_INDIRECT == abi_result.pass)
+    {
+      ll_partypes.push_back(ll_ptrtype);  // sret
+      ll_rettype = llvm::Type::getVoidTy(ll_ctx);
+    }
+    else if (ABIP_COERCE == abi_result.pass)
+    {
+      ll_rettype = abi_result.ll_abitype;
+    }
+    else
+    {
+      ll_rettype = ResolvedRetType()->GetLlType();
+    }
   }
   else
   {
     ll_rettype = llvm::Type::getVoidTy(ll_ctx);
   }
+
+#if !defined(TARGET_32BIT) && !defined(TARGET_WIN)
+  // System V x86-64: the free argument registers, the sret pointer occupies the first GPR
+  bool  track_regs = (llvm::Triple::x86_64 == llvm::Triple(ll_module->getTargetTriple()).getArch());
+  int   free_gpr = (ABIP_INDIRECT == abi_result.pass ? 5 : 6);
+  int   free_sse = 8;
+#endif
+
+  abi_params.clear();
+  for (OFuncParam * fpar : params)
+  {
+    TAbiArgInfo & abi = abi_params.emplace_back();
+    if (!fpar->IsRefLike())
+    {
+      abi = AbiClassify(fpar->ptype);
+    }
+
+#if !defined(TARGET_32BIT) && !defined(TARGET_WIN)
+    if (track_regs and (ABIP_INDIRECT != abi.pass))
+    {
+      int ngpr = 0;
+      int nsse = 0;
+      AbiCountRegs((ABIP_COERCE == abi.pass ? abi.ll_abitype : fpar->GetLlArgType()->GetLlType()), ngpr, nsse);
+      if ((ABIP_COERCE == abi.pass) and ((ngpr > free_gpr) or (nsse > free_sse)))
+      {
+        // all eightbytes of an aggregate must fit, otherwise the whole aggregate goes to the stack
+        // (LLVM would split it between the last registers and the stack)
+        abi.pass = ABIP_INDIRECT;
+        abi.ll_abitype = nullptr;
+        abi.byval = true;
+      }
+      else
+      {
+        free_gpr = max(0, free_gpr - ngpr);
+        free_sse = max(0, free_sse - nsse);
+      }
+    }
+#endif
+
+    if (ABIP_INDIRECT == abi.pass)
+    {
+      ll_partypes.push_back(ll_ptrtype);
+    }
+    else if (ABIP_COERCE == abi.pass)
+    {
+      ll_partypes.push_back(abi.ll_abitype);
+    }
+    else
+    {
+      ll_partypes.push_back(fpar->GetLlArgType()->GetLlType());
+    }
+  }
   return LlFuncType::get(ll_rettype, ll_partypes, has_varargs);
 }
 
+bool OTypeFunc::HasIndirectParam() const
+{
+  for (const TAbiArgInfo & abiparam : abi_params)
+  {
+    if (ABIP_INDIRECT == abiparam.pass)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+llvm::AttributeList OTypeFunc::CreateLlAbiAttributes()
+{
+  GetLlType();  // fills the abi_params and abi_result
+
+  llvm::AttributeList result;
+  if (HasSretResult())
+  {
+    result = result.addParamAttribute(ll_ctx, 0, llvm::Attribute::getWithStructRetType(ll_ctx, ResolvedRetType()->GetLlType()));
+    result = result.addParamAttribute(ll_ctx, 0, llvm::Attribute::NoAlias);
+  }
+  const llvm::DataLayout & dl = ll_module->getDataLayout();
+  for (size_t i = 0; i < params.size(); ++i)
+  {
+    if ((ABIP_INDIRECT == abi_params[i].pass) and abi_params[i].byval)  // otherwise a pointer to a caller made copy
+    {
+      LlType * ll_partype = params[i]->ptype->GetLlType();
+      result = result.addParamAttribute(ll_ctx, LlArgIndex(i), llvm::Attribute::getWithByValType(ll_ctx, ll_partype));
+      result = result.addParamAttribute(ll_ctx, LlArgIndex(i),
+          llvm::Attribute::getWithAlignment(ll_ctx, max(llvm::Align(TARGET_PTRSIZE), dl.getABITypeAlign(ll_partype))));
+    }
+  }
+  return result;
+}
+
+LlValue * OTypeFunc::GenerateCall(LlValue * ll_callee, vector<OExpr *> & aargs, OScope * scope)
+{
+  LlFuncType * ll_functype = static_cast<LlFuncType *>(GetLlType());
+
+  vector<LlValue *>  ll_args;
+  LlValue *          ll_sret = nullptr;
+  if (HasSretResult())
+  {
+    ll_sret = ll_create_alloca(ResolvedRetType()->GetLlType(), "sret.tmp");
+    ll_args.push_back(ll_sret);
+  }
+
+  for (size_t i = 0; i < aargs.size(); ++i)
+  {
+    if ((i < params.size()) and (ABIP_DIRECT != abi_params[i].pass))
+    {
+      OType * partype = params[i]->ptype;
+      OLValueExpr * lvarg = dynamic_cast<OLValueExpr *>(aargs[i]);
+      if (ABIP_INDIRECT == abi_params[i].pass)
+      {
+        if (lvarg and abi_params[i].byval)  // byval: the callee gets its own copy, so the original storage can be passed
+        {
+          ll_args.push_back(lvarg->GenerateAddress(scope));
+          continue;
+        }
+        LlValue * ll_tmp = ll_create_alloca(partype->GetLlType(), "byval.tmp");
+        ll_builder.CreateStore(aargs[i]->Generate(scope), ll_tmp);
+        ll_args.push_back(ll_tmp);
+      }
+      else  // ABIP_COERCE
+      {
+        LlValue * ll_src;
+        if (lvarg)
+        {
+          ll_src = lvarg->GenerateAddress(scope);
+        }
+        else
+        {
+          ll_src = ll_create_alloca(partype->GetLlType(), "coerce.src");
+          ll_builder.CreateStore(aargs[i]->Generate(scope), ll_src);
+        }
+        ll_args.push_back(AbiLoadCoerced(ll_src, partype, abi_params[i]));
+      }
+      continue;
+    }
+
+    LlValue * val = aargs[i]->Generate(scope);
+
+    // C varargs default argument promotions for extra arguments
+    if (has_varargs && i >= params.size())
+    {
+      LlType * valtype = val->getType();
+      if (valtype->isFloatTy())
+      {
+        // float32 -> double promotion
+        val = ll_builder.CreateFPExt(val, llvm::Type::getDoubleTy(ll_ctx));
+      }
+      else if (valtype->isIntegerTy() && valtype->getIntegerBitWidth() < 32)
+      {
+        // small integers use the C default argument promotions
+        OTypeInt * inttype = dynamic_cast<OTypeInt *>(aargs[i]->ResolvedType());
+        if (inttype && inttype->issigned)
+        {
+          val = ll_builder.CreateSExt(val, llvm::Type::getInt32Ty(ll_ctx));
+        }
+        else
+        {
+          val = ll_builder.CreateZExt(val, llvm::Type::getInt32Ty(ll_ctx));
+        }
+      }
+    }
+
+    ll_args.push_back(val);
+  }
+
+  llvm::CallInst * ll_call = ll_builder.CreateCall(ll_functype, ll_callee, ll_args);
+  ll_call->setAttributes(CreateLlAbiAttributes());
+
+  if (ll_sret)
+  {
+    return ll_builder.CreateLoad(ResolvedRetType()->GetLlType(), ll_sret, "sret.val");
+  }
+  if (ABIP_COERCE == abi_result.pass)
+  {
+    LlValue * ll_tmp = ll_create_alloca(ResolvedRetType()->GetLlType(), "coerce.ret");
+    AbiStoreCoerced(ll_call, ll_tmp, ResolvedRetType(), abi_result);
+    return ll_builder.CreateLoad(ResolvedRetType()->GetLlType(), ll_tmp, "coerce.val");
+  }
+  return ll_call;
+}
+
 LlDiType * OTypeFunc::CreateDiType()
 {
   vector<llvm::Metadata *> di_param_types;
@@ -521,11 +1078,57 @@ void OValSymFunc::GenGlobalDecl(bool apublic, OValue * ainitval)
   }
 
   ll_func = LlFunction::Create(ll_functype, linktype, ll_name, ll_module);
+  ll_func->setAttributes(static_cast<OTypeFunc *>(ptype)->CreateLlAbiAttributes());
   if (!attr_section_name.empty())
   {
     ll_func->setSection(attr_section_name);
   }
 
+  // inlining and code placement hints
+  if (attr_fnhints & ATTF_INLINE)    ll_func->addFnAttr(llvm::Attribute::AlwaysInline);
+  if (attr_fnhints & ATTF_NOINLINE)  ll_func->addFnAttr(llvm::Attribute::NoInline);
+  if (attr_fnhints & ATTF_HOT)       ll_func->addFnAttr(llvm::Attribute::Hot);
+  if (attr_fnhints & ATTF_COLD)      ll_func->addFnAttr(llvm::Attribute::Cold);
+  if (attr_fnhints & (ATTF_PURE | ATTF_READNONE))
+  {
+    // the calls can be merged, hoisted or removed when the result is not used
+    ll_func->setDoesNotThrow();
+    ll_func->addFnAttr(llvm::Attribute::WillReturn);
+    // the sret result is written through the hidden pointer, so the memory effects are not marked then
+    OTypeFunc * ftype = static_cast<OTypeFunc *>(ptype);
+    if (!ftype->HasSretResult())
+    {
+      if ((attr_fnhints & ATTF_READNONE) and ftype->HasIndirectParam())
+      {
+        // the callee loads the aggregate values through the hidden pointers: memory(argmem: read)
+        ll_func->setOnlyReadsMemory();
+        ll_func->setOnlyAccessesArgMemory();
+      }
+      else if (attr_fnhints & ATTF_READNONE)
+      {
+        ll_func->setDoesNotAccessMemory();
+      }
+      else
+      {
+        ll_func->setOnlyReadsMemory();
+      }
+    }
+    if (owner_compound_type)
+    {
+      ll_func->addParamAttr(ftype->LlArgIndex(0), llvm::Attribute::ReadOnly);  // __this
+    }
+  }
+
+  // the function attributes let the optimizer (vectorizer, inliner) use the selected CPU
+  if (!ll_target_cpu.empty())
+  {
+    ll_func->addFnAttr("target-cpu", ll_target_cpu);
+  }
+  if (!ll_target_features.empty())
+  {
+    ll_func->addFnAttr("target-features", ll_target_features);
+  }
+
   //ll_functions[ptfunc->name] = ll_func;
 }
 
@@ -570,6 +1173,8 @@ void OValSymFunc::MergeForwardDeclFrom(OValSymFunc * other, bool copy_param_name
   }
   attr_is_override = other->attr_is_override;
   attr_is_virtual  = other->attr_is_virtual;
+  attr_consteval   = (attr_consteval or other->attr_consteval);
+  attr_fnhints    |= other->attr_fnhints;
 }
 
 void OValSymFunc::ValidateForwardDecl() const
@@ -612,6 +1217,8 @@ void OValSymFunc::GenerateFuncBody()
     throw logic_error("GenerateFuncBody: ll_func declaration is missing");
   }
 
+  OTimeScope ts("GenerateFuncBody", name, false);  // only for the -ftime-trace
+
   OTypeFunc * tfunc = (OTypeFunc *)ptype;
 
   if (g_opt.dbg_info)
@@ -629,6 +1236,26 @@ void OValSymFunc::GenerateFuncBody()
   // Create entry block and generate body
   auto * entry = LlBasicBlock::Create(ll_ctx, "entry", ll_func);
   ll_builder.SetInsertPoint(entry);
+
+  // placeholder for the ll_create_alloca(), removed at the end
+  llvm::Instruction * prev_alloca_point = ll_alloca_point;
+  LlType * ll_i32 = LlType::getInt32Ty(ll_ctx);
+  ll_alloca_point = new llvm::BitCastInst(llvm::UndefValue::get(ll_i32), ll_i32, "allocapt", entry);
+
+  // the IRBuilder puts these flags to every floating point operation of the function
+  llvm::FastMathFlags fmf;
+  if (g_opt.fast_math or attr_fastmath)
+  {
+    fmf.setFast();
+  }
+  else if (FPCONTRACT_FAST == g_opt.fp_contract)
+  {
+    fmf.setAllowContract();  // the -ffp-contract=on uses the llvm.fmuladd within the expressions
+  }
+  ll_builder.setFastMathFlags(fmf);
+
+  ll_int_overflow = (attr_overflow >= 0 ? attr_overflow : g_opt.int_overflow);
+  ll_bounds_check = (attr_bounds_check >= 0 ? (attr_bounds_check != 0) : g_opt.bounds_check);
   if (g_opt.dbg_info)
   {
     ll_builder.SetCurrentDebugLocation(llvm::DILocation::get(ll_ctx, scpos.line, scpos.col, di_func));
@@ -639,7 +1266,15 @@ void OValSymFunc::GenerateFuncBody()
   if (vsresult)
   {
     ll_rettype = vsresult->ptype->GetLlType();
-    vsresult->ll_value = ll_builder.CreateAlloca(ll_rettype, nullptr, "result");
+    if (tfunc->HasSretResult())
+    {
+      vsresult->ll_value = ll_func->getArg(0);  // written directly to the caller's storage
+      vsresult->ll_value->setName("result");
+    }
+    else
+    {
+      vsresult->ll_value = ll_create_alloca(ll_rettype, "result");
+    }
     ll_builder.CreateStore(llvm::Constant::getNullValue(ll_rettype), vsresult->ll_value);
     if (g_opt.dbg_info)
     {
@@ -651,15 +1286,29 @@ void OValSymFunc::GenerateFuncBody()
   }
 
   // Create allocas for parameters
-  int i = 0;
-  for (auto & arg : ll_func->args())
+  for (size_t i = 0; i < tfunc->params.size(); ++i)
   {
-    OFuncParam *  fpar  = tfunc->params[i];
-    OValSym *     vsarg = args[i];
+    OFuncParam *      fpar  = tfunc->params[i];
+    OValSym *         vsarg = args[i];
+    llvm::Argument *  arg   = ll_func->getArg(tfunc->LlArgIndex(i));
 
-    arg.setName(fpar->name);
-    vsarg->ll_value = ll_builder.CreateAlloca(fpar->GetLlArgType()->GetLlType(), nullptr, fpar->name);
-    ll_builder.CreateStore(&arg, vsarg->ll_value);
+    arg->setName(fpar->name);
+    if (ABIP_INDIRECT == tfunc->abi_params[i].pass)
+    {
+      vsarg->ll_value = arg;  // the byval / caller made copy is the local storage
+    }
+    else
+    {
+      vsarg->ll_value = ll_create_alloca(fpar->GetLlArgType()->GetLlType(), fpar->name);
+      if (ABIP_COERCE == tfunc->abi_params[i].pass)
+      {
+        AbiStoreCoerced(arg, vsarg->ll_value, fpar->ptype, tfunc->abi_params[i]);
+      }
+      else
+      {
+        ll_builder.CreateStore(arg, vsarg->ll_value);
+      }
+    }
     if (g_opt.dbg_info)
     {
       llvm::DILocalVariable * di_var = di_builder->createParameterVariable(
@@ -672,7 +1321,6 @@ void OValSymFunc::GenerateFuncBody()
           ll_builder.GetInsertBlock()
       );
     }
-    ++i;
   }
 
   // STATEMENTS
@@ -684,6 +1332,27 @@ void OValSymFunc::GenerateFuncBody()
     GenerateFuncRet();
   }
 
+  ll_alloca_point->eraseFromParent();
+  ll_alloca_point = prev_alloca_point;
+  ll_builder.clearFastMathFlags();
+
+  if (attr_fnhints & ATTF_FLATTEN)
+  {
+    // [[flatten]]: the direct calls of the body are inlined (also at -O0), except the self recursion
+    for (LlBasicBlock & bb : *ll_func)
+    {
+      for (llvm::Instruction & inst : bb)
+      {
+        auto * ll_call = llvm::dyn_cast<llvm::CallInst>(&inst);
+        LlFunction * ll_callee = (ll_call ? ll_call->getCalledFunction() : nullptr);
+        if (ll_callee and (ll_callee != ll_func) and !ll_callee->hasFnAttribute(llvm::Attribute::NoInline))
+        {
+          ll_call->addFnAttr(llvm::Attribute::AlwaysInline);
+        }
+      }
+    }
+  }
+
   verifyFunction(*ll_func);
 }
 
@@ -700,14 +1369,23 @@ void OValSymFunc::GenerateFuncRet()
     ll_builder.SetCurrentDebugLocation(llvm::DILocation::get(ll_ctx, scpos_endfunc.line, scpos_endfunc.col, di_func));
   }
 
-  if (!ll_rettype)
+  OTypeFunc * tfunc = (OTypeFunc *)ptype;
+  if (!ll_rettype or tfunc->HasSretResult())
   {
     ll_builder.CreateRetVoid();
   }
   else
   {
     // Return the value of 'result'
-    LlValue * ll_result = ll_builder.CreateLoad(ll_rettype, vsresult->ll_value, "result");
+    LlValue * ll_result;
+    if (ABIP_COERCE == tfunc->abi_result.pass)
+    {
+      ll_result = AbiLoadCoerced(vsresult->ll_value, vsresult->ptype, tfunc->abi_result);
+    }
+    else
+    {
+      ll_result = ll_builder.CreateLoad(ll_rettype, vsresult->ll_value, "result");
+    }
     ll_builder.CreateRet(ll_result);
   }
 }
@@ -881,7 +1559,7 @@ LlConst * OValueFuncRef::CreateLlConst()
   return target_func->ll_func;
 }
 
-bool OValueFuncRef::CalculateConstant(OExpr * expr, bool emit_errors)
+bool OValueFuncRef::CalculateConstantExpr(OExpr * expr, bool emit_errors)
 {
   is_null = true;
   target_func = nullptr;
@@ -37,6 +37,35 @@ struct TFuncCallArgMatch
   bool     has_init_diags = false;
 };
 
+/* Aggregate calling convention (C ABI compatible, see AbiClassify()):
+     - fixed arrays and structs above 16 bytes are passed by a hidden pointer and returned
+       through a hidden first parameter (sret), the pointer is byval on System V x86-64 and
+       i386, it points to a caller made copy on Windows x64, AArch64 and RISC-V
+     - the smaller ones are passed in registers, coerced to integer / floating point eightbytes
+     - System V x86-64: a small aggregate whose eightbytes do not fit into the remaining
+       argument registers goes to the stack as a whole (byval), see OTypeFunc::CreateLlType()
+     - AArch64: the homogeneous floating point / short vector aggregates (up to 4 members) go
+       to the SIMD registers regardless of their size
+     - RISC-V LP64D: a small struct of one or two floating point members, or of one floating
+       point and one integer member goes to the floating point registers
+*/
+
+enum EAbiPass
+{
+  ABIP_DIRECT = 0,  // first class LLVM value
+  ABIP_COERCE,      // small aggregate as the ll_abitype
+  ABIP_INDIRECT     // hidden pointer: byval parameter / sret result
+};
+
+struct TAbiArgInfo
+{
+  EAbiPass   pass = ABIP_DIRECT;
+  LlType *   ll_abitype = nullptr;  // the LLVM type at the call boundary
+  bool       byval = false;         // ABIP_INDIRECT parameter: byval, or a pointer to a caller made copy
+};
+
+TAbiArgInfo AbiClassify(OType * atype);
+
 struct TFuncCallMatchScore
 {
   int   conversions = 0;
@@ -91,6 +120,10 @@ public:
   vector<OFuncParam *>  params;
   bool                  has_varargs = false;
 
+  // filled by CreateLlType()
+  vector<TAbiArgInfo>   abi_params;
+  TAbiArgInfo           abi_result;
+
   OTypeFunc(const string aname, OType * arettype = nullptr)
   :
     super(aname, TK_FUNCTION),
@@ -120,6 +153,13 @@ public:
   static int    CompareCallCandidateScore(const TFuncCallMatchScore & left,
                                           const TFuncCallMatchScore & right);
 
+  inline bool      HasSretResult() const  { return (ABIP_INDIRECT == abi_result.pass); }
+  inline unsigned  LlArgIndex(size_t aparidx) const  { return unsigned(aparidx) + (HasSretResult() ? 1 : 0); }
+  bool             HasIndirectParam() const;  // an aggregate parameter is passed through a hidden pointer
+
+  llvm::AttributeList  CreateLlAbiAttributes();
+  LlValue *  GenerateCall(LlValue * ll_callee, vector<OExpr *> & aargs, OScope * scope);
+
   LlType * CreateLlType() override;
   LlDiType * CreateDiType() override;
 };
@@ -144,6 +184,11 @@ public:
 
   bool               has_body = false;
   bool               is_external = false;
+  bool               attr_fastmath = false;  // [[fastmath]]
+  int                attr_overflow = -1;     // [[overflow(wrap|nsw|trap)]], -1 = command line setting
+  int                attr_bounds_check = -1; // [[bounds_check(on|off)]]: 1 = on, 0 = off, -1 = command line setting
+  bool               attr_consteval = false; // [[consteval]]: evaluated at compile time in constant expressions
+  uint64_t           attr_fnhints = 0;       // [[inline]], [[noinline]], [[flatten]], [[hot]], [[cold]], [[pure]], [[readnone]] (EAttrFlag)
   string             external_linkage_name = "";
   string             generated_linkage_name = "";
 
@@ -237,7 +282,7 @@ public:
   }
 
   LlConst *  CreateLlConst() override;
-  bool       CalculateConstant(OExpr * expr, bool emit_errors = true) override;
+  bool       CalculateConstantExpr(OExpr * expr, bool emit_errors) override;
 };
 
 class OTypeFuncRef : public OType
@@ -18,7 +18,7 @@
 #include "dqc.h"
 #include <cmath>
 
-static int64_t NormalizeIntConstant(OTypeInt * dsttype, uint64_t rawbits)
+int64_t NormalizeIntConstant(OTypeInt * dsttype, uint64_t rawbits)
 {
   if (dsttype->bitlength >= 64)
   {
@@ -46,7 +46,7 @@ LlConst * OValueInt::CreateLlConst()
   return llvm::ConstantInt::get(ptype->GetLlType(), value);
 }
 
-bool OValueInt::CalculateConstant(OExpr * expr, bool emit_errors)
+bool OValueInt::CalculateConstantExpr(OExpr * expr, bool emit_errors)
 {
   value = 0;
 
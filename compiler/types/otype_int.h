@@ -31,7 +31,7 @@ public:
   }
 
   LlConst *  CreateLlConst() override;
-  bool       CalculateConstant(OExpr * expr, bool emit_errors = true) override;
+  bool       CalculateConstantExpr(OExpr * expr, bool emit_errors) override;
 };
 
 class OTypeInt : public OType
@@ -83,4 +83,7 @@ public:
   }
 };
 
+// truncates the raw bits to the type width with sign extension for the signed types
+int64_t NormalizeIntConstant(OTypeInt * dsttype, uint64_t rawbits);
+
 // later OTypeUint will be created for unsigned
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    otype_vector.cpp
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   SIMD vector types
+ */
+
+#include <vector>
+#include "otype_vector.h"
+#include "otype_int.h"
+#include "expressions.h"
+#include "scope_builtins.h"
+#include "dqc.h"
+
+using namespace std;
+
+OValueVector::OValueVector(OTypeVector * atype)
+:
+  super(atype)
+{
+  elements.reserve(atype->lanes);
+  for (uint32_t i = 0; i < atype->lanes; ++i)
+  {
+    elements.push_back(atype->elemtype->CreateValue());
+  }
+}
+
+OValueVector::~OValueVector()
+{
+  for (OValue * elem : elements)
+  {
+    delete elem;
+  }
+}
+
+LlConst * OValueVector::CreateLlConst()
+{
+  vector<LlConst *> ll_elems;
+  ll_elems.reserve(elements.size());
+  for (OValue * elem : elements)
+  {
+    ll_elems.push_back(elem->GetLlConst());
+  }
+
+  return llvm::ConstantVector::get(ll_elems);
+}
+
+bool OValueVector::CalculateConstantExpr(OExpr * expr, bool emit_errors)
+{
+  auto * vectype = static_cast<OTypeVector *>(ptype);
+
+  // the implicit conversions are wrapped into type conversion to the vector type
+  auto * conv = dynamic_cast<OExprTypeConv *>(expr);
+  if (conv and (conv->ResolvedType() == vectype))
+  {
+    expr = conv->src;
+  }
+
+  if (auto * arrlit = dynamic_cast<OArrayLit *>(expr))
+  {
+    if (arrlit->elements.size() != vectype->lanes)
+    {
+      g_compiler->Error(DQERR_ARR_ELEMCOUNT_MISM, to_string(vectype->lanes), to_string(arrlit->elements.size()));
+      return false;
+    }
+
+    for (size_t i = 0; i < arrlit->elements.size(); ++i)
+    {
+      if (!elements[i]->CalculateConstant(arrlit->elements[i], emit_errors))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // scalar broadcast
+  for (OValue * elem : elements)
+  {
+    if (!elem->CalculateConstant(expr, emit_errors))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// OTypeVector
+
+OTypeVector * OTypeVector::GetMaskType()
+{
+  return g_builtins->type_bool->GetVectorType(lanes);
+}
+
+OValue * OTypeVector::CreateValue()
+{
+  return new OValueVector(this);
+}
+
+LlType * OTypeVector::CreateLlType()
+{
+  return llvm::FixedVectorType::get(elemtype->GetLlType(), lanes);
+}
+
+LlDiType * OTypeVector::CreateDiType()
+{
+  llvm::Metadata * subscripts[] = {
+    di_builder->getOrCreateSubrange(0, lanes)
+  };
+  return di_builder->createVectorType(
+      bytesize * 8,
+      0,
+      elemtype->GetDiType(),
+      di_builder->getOrCreateArray(subscripts)
+  );
+}
+
+LlValue * OTypeVector::GenerateConversion(OScope * scope, OExpr * src)
+{
+  // vector literal, the elements are already converted to the element type
+  if (auto * arrlit = dynamic_cast<OArrayLit *>(src))
+  {
+    LlValue * ll_vec = llvm::PoisonValue::get(GetLlType());
+    for (size_t i = 0; i < arrlit->elements.size(); ++i)
+    {
+      LlValue * ll_elem = arrlit->elements[i]->Generate(scope);
+      ll_vec = ll_builder.CreateInsertElement(ll_vec, ll_elem, uint64_t(i));
+    }
+    return ll_vec;
+  }
+
+  OType * srctype = src->ResolvedType();
+  LlValue * ll_value = src->Generate(scope);
+
+  // scalar broadcast, the scalar is already converted to the element type
+  if (TK_VECTOR != srctype->kind)
+  {
+    return ll_builder.CreateVectorSplat(lanes, ll_value, "splat");
+  }
+
+  // lane-wise conversion with the same lane count (explicit casts only)
+  OType * srcelem = static_cast<OTypeVector *>(srctype)->elemtype->ResolveAlias();
+  OType * dstelem = elemtype->ResolveAlias();
+  bool srcsigned = ((TK_INT == srcelem->kind) and static_cast<OTypeInt *>(srcelem)->issigned);
+
+  if (TK_FLOAT == dstelem->kind)
+  {
+    if (TK_FLOAT == srcelem->kind)
+    {
+      return ll_builder.CreateFPCast(ll_value, GetLlType());
+    }
+    return (srcsigned ? ll_builder.CreateSIToFP(ll_value, GetLlType())
+                      : ll_builder.CreateUIToFP(ll_value, GetLlType()));
+  }
+
+  if (TK_INT == dstelem->kind)
+  {
+    return ll_builder.CreateIntCast(ll_value, GetLlType(), srcsigned);  // the masks are zero extended like the bools
+  }
+
+  throw logic_error(format("Unsupported vector conversion from \"{}\" to \"{}\"", srctype->name, name));
+}
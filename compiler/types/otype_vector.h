@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Viktor Nagy
+ * This file is part of the DQ-Compiler project at https://github.com/nvitya/dq-comp
+ *
+ * This source code is licensed under the MIT License.
+ * See the LICENSE file in the project root for the full license text.
+ * ---------------------------------------------------------------------------------
+ * file:    otype_vector.h
+ * authors: nvitya
+ * created: 2026-10-17
+ * brief:   SIMD vector types
+ */
+
+#pragma once
+
+#include "symbols.h"
+
+class OValueVector : public OValue
+{
+private:
+  using        super = OValue;
+
+public:
+  vector<OValue *> elements;
+
+  OValueVector(OTypeVector * atype);
+  ~OValueVector() override;
+
+  LlConst *  CreateLlConst() override;
+  bool       CalculateConstantExpr(OExpr * expr, bool emit_errors) override;
+};
+
+// Fixed length SIMD vector, e.g. float32x8, int32x4
+// LLVM representation: <N x T>, e.g. <8 x float>
+// The lane-wise comparisons result masks with bool elements (boolx8 = <8 x i1>)
+
+class OTypeVector : public OType
+{
+private:
+  using        super = OType;
+
+public:
+  OType *      elemtype;
+  uint32_t     lanes;
+
+  OTypeVector(OType * aelemtype, uint32_t alanes)
+  :
+    super(aelemtype->name + "x" + to_string(alanes), TK_VECTOR),
+    elemtype(aelemtype),
+    lanes(alanes)
+  {
+    if (IsMask())
+    {
+      bytesize = (alanes + 7) >> 3;  // the masks are bit packed in the memory
+    }
+    else
+    {
+      bytesize = aelemtype->bytesize * alanes;
+    }
+  }
+
+  inline bool    IsMask()       { return (TK_BOOL == elemtype->kind); }
+  inline bool    IsFloat()      { return (TK_FLOAT == elemtype->kind); }
+  OTypeVector *  GetMaskType();  // boolxN with the same lane count
+
+  OValue *   CreateValue() override;
+  LlType *   CreateLlType() override;
+  LlDiType * CreateDiType() override;
+  LlValue *  GenerateConversion(OScope * scope, OExpr * src) override;
+};